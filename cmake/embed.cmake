@@ -0,0 +1,176 @@
+# --------------------------------------------------------------------------------------------------------
+# Embedding
+# └ Turns a directory into a constant asset table that can be passed to `webview::embed`. The file contents
+#   are pulled in by the compiler (`#embed`) or the assembler (`.incbin`), so they never pass through the
+#   C++ frontend as hex literals and end up in read-only data. MSVC supports neither, which is why we fall
+#   back to generating byte arrays there.
+#
+#   saucer_embed(<target> DIRECTORY <dir> [HEADER <path>] [NAMESPACE <namespace>])
+#
+#   The generated header (default: "embedded/all.hpp") exposes `<namespace>::all()` (default namespace:
+#   "saucer::embedded") and is added to the include directories of the given target.
+# --------------------------------------------------------------------------------------------------------
+
+set(saucer_embed_mime_types
+  ".html=text/html" ".htm=text/html" ".css=text/css" ".js=application/javascript" ".mjs=application/javascript"
+  ".json=application/json" ".map=application/json" ".wasm=application/wasm" ".txt=text/plain" ".xml=application/xml"
+  ".svg=image/svg+xml" ".png=image/png" ".jpg=image/jpeg" ".jpeg=image/jpeg" ".gif=image/gif" ".webp=image/webp"
+  ".avif=image/avif" ".ico=image/x-icon" ".bmp=image/bmp" ".woff=font/woff" ".woff2=font/woff2" ".ttf=font/ttf"
+  ".otf=font/otf" ".pdf=application/pdf" ".mp3=audio/mpeg" ".wav=audio/wav" ".ogg=audio/ogg" ".mp4=video/mp4"
+  ".webm=video/webm"
+  CACHE INTERNAL ""
+)
+
+function(saucer_embed_mime FILE OUTPUT)
+  get_filename_component(extension "${FILE}" LAST_EXT)
+  string(TOLOWER "${extension}" extension)
+
+  set(mime "application/octet-stream")
+
+  foreach (entry IN LISTS saucer_embed_mime_types)
+    if (entry MATCHES "^${extension}=(.+)$")
+      set(mime "${CMAKE_MATCH_1}")
+      break()
+    endif()
+  endforeach()
+
+  set(${OUTPUT} "${mime}" PARENT_SCOPE)
+endfunction()
+
+function(saucer_embed TARGET)
+  cmake_parse_arguments(PARSE_ARGV 1 embed "" "DIRECTORY;HEADER;NAMESPACE" "")
+
+  if (NOT embed_DIRECTORY)
+    message(FATAL_ERROR "[saucer] saucer_embed: No DIRECTORY given")
+  endif()
+
+  if (NOT embed_HEADER)
+    set(embed_HEADER "embedded/all.hpp")
+  endif()
+
+  if (NOT embed_NAMESPACE)
+    set(embed_NAMESPACE "saucer::embedded")
+  endif()
+
+  get_filename_component(directory "${embed_DIRECTORY}" ABSOLUTE)
+  file(GLOB_RECURSE files LIST_DIRECTORIES false "${directory}/*")
+  list(SORT files)
+  list(LENGTH files embed_COUNT)
+
+  string(MAKE_C_IDENTIFIER "${TARGET}" identifier)
+  set(output "${CMAKE_CURRENT_BINARY_DIR}/saucer_embed/${identifier}")
+
+  # Sizes and hashes are baked into the header, any change to the embedded directory thus re-runs configure.
+  set_property(DIRECTORY APPEND PROPERTY CMAKE_CONFIGURE_DEPENDS "${directory}" ${files})
+
+  set(symbols "")
+  set(entries "")
+  set(embeds  "")
+  set(incbins "")
+  set(arrays  "")
+
+  set(index 0)
+
+  foreach (file IN LISTS files)
+    file(RELATIVE_PATH name "${directory}" "${file}")
+    file(SIZE "${file}" size)
+    file(MD5 "${file}" hash)
+
+    saucer_embed_mime("${file}" mime)
+
+    if (size EQUAL 0)
+      string(APPEND entries "        saucer::embedded_asset{.name = \"${name}\", .content = {}, .mime = \"${mime}\", .etag = R\"(\"${hash}\")\"},\n")
+      continue()
+    endif()
+
+    set(symbol "saucer_embedded_${identifier}_${index}")
+    math(EXPR index "${index} + 1")
+
+    string(APPEND symbols "    extern const std::uint8_t ${symbol}[];\n")
+    string(APPEND entries "        saucer::embedded_asset{.name = \"${name}\", .content = {${symbol}, ${size}}, .mime = \"${mime}\", .etag = R\"(\"${hash}\")\"},\n")
+
+    string(APPEND embeds  "extern \"C\" alignas(16) const std::uint8_t ${symbol}[] = {\n#embed \"${file}\"\n};\n")
+    string(APPEND incbins "SAUCER_INCBIN(${symbol}, \"${file}\");\n")
+
+    if (MSVC)
+      file(READ "${file}" content HEX)
+      string(REGEX REPLACE "([0-9a-f][0-9a-f])" "0x\\1," content "${content}")
+      string(APPEND arrays "extern \"C\" alignas(16) const std::uint8_t ${symbol}[] = {${content}};\n")
+    endif()
+  endforeach()
+
+  file(CONFIGURE OUTPUT "${output}/include/${embed_HEADER}" @ONLY CONTENT [=[
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include <saucer/embedded.hpp>
+
+extern "C"
+{
+@symbols@}
+
+namespace @embed_NAMESPACE@
+{
+    static constexpr saucer::asset_table assets{std::array<saucer::embedded_asset, @embed_COUNT@>{
+@entries@    }};
+
+    inline saucer::embedded_assets all()
+    {
+        return assets;
+    }
+} // namespace @embed_NAMESPACE@
+]=])
+
+  if (MSVC)
+    message(STATUS "[saucer] Embedding '${directory}' as byte arrays, as neither #embed nor .incbin are available")
+    set(source [=[
+#include "@embed_HEADER@"
+
+@arrays@]=])
+  else()
+    set(source [=[
+#include "@embed_HEADER@"
+#include "data.hpp"
+]=])
+
+    file(CONFIGURE OUTPUT "${output}/data.hpp" @ONLY CONTENT [=[
+#pragma once
+#pragma GCC system_header
+
+#if defined(__has_embed)
+@embeds@
+#else
+
+#if defined(__APPLE__)
+#define SAUCER_SECTION ".const_data"
+#define SAUCER_SYMBOL(name) "_" #name
+#elif defined(_WIN32)
+#define SAUCER_SECTION ".section .rdata,\"dr\""
+#define SAUCER_SYMBOL(name) #name
+#else
+#define SAUCER_SECTION ".section .rodata"
+#define SAUCER_SYMBOL(name) #name
+#endif
+
+#define SAUCER_INCBIN(name, file)           \
+    __asm__(SAUCER_SECTION "\n"              \
+            ".global " SAUCER_SYMBOL(name) "\n" \
+            ".balign 16\n"                    \
+            SAUCER_SYMBOL(name) ":\n"         \
+            ".incbin \"" file "\"\n"          \
+            ".text\n")
+
+@incbins@
+#endif
+]=])
+  endif()
+
+  file(CONFIGURE OUTPUT "${output}/data.cpp" @ONLY CONTENT "${source}")
+
+  target_sources(${TARGET} PRIVATE "${output}/data.cpp")
+  target_include_directories(${TARGET} PRIVATE "${output}/include")
+
+  set_source_files_properties("${output}/data.cpp" PROPERTIES OBJECT_DEPENDS "${files}")
+endfunction()
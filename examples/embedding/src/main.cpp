@@ -1,5 +1,5 @@
 #include <saucer/webview.hpp>
-#include "../embedded/all.hpp"
+#include <embedded/all.hpp>
 
 int main()
 {
@@ -50,6 +50,7 @@ namespace saucer
         using callback_t = std::move_only_function<void()>;
 
       private:
+        std::size_t m_threads;
         poolparty::pool<> m_pool;
         std::unique_ptr<impl> m_impl;
 
@@ -65,6 +66,7 @@ namespace saucer
 
       public:
         [[sc::unstable]] [[nodiscard]] poolparty::pool<> &pool();
+        [[nodiscard]] std::size_t threads() const;
 
       public:
         [[nodiscard]] bool thread_safe() const;
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "scheme.hpp"
+
+#include <span>
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+namespace saucer
+{
+    struct embedded_asset
+    {
+        std::string_view name;
+        std::span<const std::uint8_t> content;
+        std::string_view mime;
+
+      public:
+        std::string_view etag{};
+        scheme::encoding encoding{scheme::encoding::identity};
+    };
+
+    class embedded_assets
+    {
+        std::span<const embedded_asset> m_assets;
+        std::span<const std::uint32_t> m_seeds;
+
+      public:
+        consteval embedded_assets(std::span<const embedded_asset> assets, std::span<const std::uint32_t> seeds);
+
+      public:
+        [[nodiscard]] constexpr std::size_t size() const;
+        [[nodiscard]] constexpr std::span<const embedded_asset> entries() const;
+
+      public:
+        [[nodiscard]] constexpr std::optional<std::size_t> index_of(std::string_view name) const;
+        [[nodiscard]] constexpr const embedded_asset *find(std::string_view name) const;
+    };
+
+    template <std::size_t N>
+    class asset_table
+    {
+        std::array<embedded_asset, N> m_assets;
+        std::array<std::uint32_t, N> m_seeds;
+
+      public:
+        consteval asset_table(std::array<embedded_asset, N> assets);
+
+      public:
+        [[nodiscard]] consteval operator embedded_assets() const;
+    };
+} // namespace saucer
+
+#include "embedded.inl"
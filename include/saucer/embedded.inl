@@ -0,0 +1,197 @@
+#pragma once
+
+#include "embedded.hpp"
+
+#include <algorithm>
+
+namespace saucer
+{
+    namespace impl
+    {
+        constexpr std::uint64_t hash(std::string_view key, std::uint64_t seed)
+        {
+            auto rtn = 0xcbf29ce484222325 ^ (seed * 0x9e3779b97f4a7c15);
+
+            for (const auto c : key)
+            {
+                rtn ^= static_cast<std::uint8_t>(c);
+                rtn *= 0x100000001b3;
+            }
+
+            rtn ^= rtn >> 33;
+            rtn *= 0xff51afd7ed558ccd;
+            rtn ^= rtn >> 33;
+
+            return rtn;
+        }
+
+        static constexpr std::uint32_t direct = 1u << 31;
+    } // namespace impl
+
+    // The views are not owning, the constructor is thus consteval: A constant expression may only refer to objects of static
+    // storage duration, which means that a table that would be gone before the webview is rejected at compile time.
+
+    consteval embedded_assets::embedded_assets(std::span<const embedded_asset> assets, std::span<const std::uint32_t> seeds)
+        : m_assets(assets), m_seeds(seeds)
+    {
+    }
+
+    constexpr std::size_t embedded_assets::size() const
+    {
+        return m_assets.size();
+    }
+
+    constexpr std::span<const embedded_asset> embedded_assets::entries() const
+    {
+        return m_assets;
+    }
+
+    constexpr std::optional<std::size_t> embedded_assets::index_of(std::string_view name) const
+    {
+        if (m_assets.empty())
+        {
+            return std::nullopt;
+        }
+
+        const auto seed = m_seeds[impl::hash(name, 0) % m_seeds.size()];
+        const auto slot = seed & impl::direct ? seed & ~impl::direct : impl::hash(name, seed) % m_assets.size();
+
+        if (m_assets[slot].name != name)
+        {
+            return std::nullopt;
+        }
+
+        return slot;
+    }
+
+    constexpr const embedded_asset *embedded_assets::find(std::string_view name) const
+    {
+        const auto index = index_of(name);
+
+        if (!index.has_value())
+        {
+            return nullptr;
+        }
+
+        return &m_assets[index.value()];
+    }
+
+    template <std::size_t N>
+    consteval asset_table<N>::asset_table(std::array<embedded_asset, N> assets) : m_assets{}, m_seeds{}
+    {
+        // Hash and displace: Assets are grouped into buckets by their unseeded hash. Starting with the largest bucket, a
+        // seed is searched for each bucket that places all of its assets into free slots. Buckets holding a single asset
+        // are put into the next free slot directly, which is then encoded into the seed.
+
+        std::array<std::size_t, N> bucket{};
+        std::array<std::size_t, N> count{};
+
+        auto largest = 0uz;
+
+        for (auto i = 0uz; N > i; ++i)
+        {
+            bucket[i] = impl::hash(assets[i].name, 0) % N;
+            largest   = std::max(largest, ++count[bucket[i]]);
+        }
+
+        // `order` is sorted by bucket, the assets of bucket `b` are thus found at `order[start[b]...start[b] + count[b]]`
+
+        std::array<std::size_t, N> start{};
+        std::array<std::size_t, N> order{};
+        std::array<std::size_t, N> filled{};
+
+        for (auto i = 1uz; N > i; ++i)
+        {
+            start[i] = start[i - 1] + count[i - 1];
+        }
+
+        for (auto i = 0uz; N > i; ++i)
+        {
+            order[start[bucket[i]] + filled[bucket[i]]++] = i;
+        }
+
+        std::array<bool, N> taken{};
+        std::array<std::size_t, N> slots{};
+
+        auto place = [&](std::size_t current)
+        {
+            const auto begin = start[current];
+            const auto end   = begin + count[current];
+
+            for (auto i = begin; end > i; ++i)
+            {
+                for (auto j = begin; i > j; ++j)
+                {
+                    if (assets[order[i]].name == assets[order[j]].name)
+                    {
+                        throw "Duplicate asset name";
+                    }
+                }
+            }
+
+            for (std::uint32_t seed = 1;; ++seed)
+            {
+                auto placed = true;
+
+                for (auto i = begin; end > i && placed; ++i)
+                {
+                    const auto slot = impl::hash(assets[order[i]].name, seed) % N;
+                    const auto used = slots.begin() + (i - begin);
+
+                    placed = !taken[slot] && std::find(slots.begin(), used, slot) == used;
+                    *used  = slot;
+                }
+
+                if (!placed)
+                {
+                    continue;
+                }
+
+                for (auto i = begin; end > i; ++i)
+                {
+                    taken[slots[i - begin]]    = true;
+                    m_assets[slots[i - begin]] = assets[order[i]];
+                }
+
+                m_seeds[current] = seed;
+                return;
+            }
+        };
+
+        for (auto size = largest; size > 1; --size)
+        {
+            for (auto current = 0uz; N > current; ++current)
+            {
+                if (count[current] != size)
+                {
+                    continue;
+                }
+
+                place(current);
+            }
+        }
+
+        for (auto current = 0uz, free = 0uz; N > current; ++current)
+        {
+            if (count[current] != 1)
+            {
+                continue;
+            }
+
+            while (taken[free])
+            {
+                ++free;
+            }
+
+            taken[free]      = true;
+            m_assets[free]   = assets[order[start[current]]];
+            m_seeds[current] = static_cast<std::uint32_t>(free) | impl::direct;
+        }
+    }
+
+    template <std::size_t N>
+    consteval asset_table<N>::operator embedded_assets() const
+    {
+        return {m_assets, m_seeds};
+    }
+} // namespace saucer
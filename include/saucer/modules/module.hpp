@@ -6,6 +6,7 @@
 #include <unordered_map>
 #include <optional>
 #include <string>
+#include <string_view>
 
 #include <eraser/erased.hpp>
 
@@ -14,18 +15,22 @@ namespace saucer
     namespace modules
     {
         using webview = eraser::interface<eraser::method<0,
-                                                         [](auto &self, const auto &message)
+                                                         [](auto &self, std::string_view message)
                                                          {
                                                              if constexpr (requires { self.on_message(message); })
                                                              {
                                                                  return self.on_message(message);
                                                              }
+                                                             else if constexpr (requires { self.on_message(std::string{}); })
+                                                             {
+                                                                 return self.on_message(std::string{message});
+                                                             }
                                                              else
                                                              {
                                                                  return false;
                                                              }
                                                          },
-                                                         bool(const std::string &)>>;
+                                                         bool(std::string_view)>>;
     } // namespace modules
 
     template <typename T>
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "scheme.hpp"
+#include "webview.hpp"
+
+#include <memory>
+#include <cstddef>
+#include <optional>
+#include <expected>
+#include <filesystem>
+#include <string_view>
+
+namespace saucer
+{
+    class asset_pack
+    {
+        struct impl;
+
+      private:
+        std::shared_ptr<impl> m_impl;
+
+      private:
+        asset_pack();
+
+      public:
+        [[nodiscard]] std::size_t size() const;
+        [[nodiscard]] std::optional<embedded_file> find(std::string_view name) const;
+
+      public:
+        std::expected<scheme::response, scheme::error> operator()(const scheme::request &) const;
+
+      public:
+        [[nodiscard]] static std::optional<asset_pack> open(const fs::path &file);
+        [[nodiscard]] static bool create(const fs::path &directory, const fs::path &output);
+    };
+} // namespace saucer
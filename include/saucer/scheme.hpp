@@ -4,8 +4,16 @@
 #include "stash/stash.hpp"
 
 #include <map>
+#include <chrono>
 #include <string>
 #include <memory>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <expected>
+#include <filesystem>
+#include <string_view>
 
 namespace saucer::scheme
 {
@@ -18,6 +26,56 @@ namespace saucer::scheme
         failed,
     };
 
+    enum class encoding : std::uint8_t
+    {
+        identity,
+        gzip,
+        brotli,
+    };
+
+    enum class priority : std::uint8_t
+    {
+        high,
+        normal,
+        low,
+    };
+
+    struct limits
+    {
+        std::size_t concurrency{0};
+        scheme::priority priority{scheme::priority::normal};
+    };
+
+    struct byte_range
+    {
+        std::optional<std::size_t> start;
+        std::optional<std::size_t> end;
+    };
+
+    class stream
+    {
+        struct impl;
+
+      private:
+        std::shared_ptr<impl> m_impl;
+
+      public:
+        stream(std::size_t capacity = 1024uz * 1024);
+
+      public:
+        [[sc::may_block]] bool write(stash<> chunk);
+        void close();
+
+      public:
+        [[nodiscard]] bool finished() const;
+        [[nodiscard]] std::optional<stash<>> poll();
+        [[sc::may_block]] [[nodiscard]] std::optional<stash<>> read();
+
+      public:
+        void cancel();
+        void on_ready(std::function<void()> callback);
+    };
+
     struct response
     {
         stash<> data;
@@ -26,6 +84,7 @@ namespace saucer::scheme
 
       public:
         int status{200};
+        std::optional<scheme::stream> stream{};
     };
 
     class request
@@ -49,11 +108,45 @@ namespace saucer::scheme
         [[nodiscard]] std::string url() const;
         [[nodiscard]] std::string method() const;
 
+      public:
+        [[nodiscard]] std::string_view url_view() const;
+        [[nodiscard]] std::string_view method_view() const;
+
       public:
         [[nodiscard]] stash<> content() const;
         [[nodiscard]] std::map<std::string, std::string> headers() const;
+        [[nodiscard]] std::optional<std::string_view> header(std::string_view name) const;
+
+      public:
+        [[sc::may_block]] [[nodiscard]] std::optional<stash<>> read(std::size_t size = 64uz * 1024) const;
+
+      public:
+        [[nodiscard]] std::optional<byte_range> range() const;
+        [[nodiscard]] bool accepts(encoding) const;
     };
 
     using executor = saucer::executor<response, error>;
     using resolver = std::function<void(request, executor)>;
+
+    [[nodiscard]] std::string etag(const stash<> &);
+    [[nodiscard]] std::string http_date(std::chrono::system_clock::time_point);
+
+    [[nodiscard]] response ranged(const request &, response);
+    [[nodiscard]] response validated(const request &, response);
+    [[nodiscard]] std::optional<stash<>> decompress(const stash<> &, encoding);
+    [[sc::may_block]] [[nodiscard]] std::optional<stash<>> spool(const request &, std::size_t threshold = 4uz * 1024 * 1024);
+
+    class directory
+    {
+        struct impl;
+
+      private:
+        std::shared_ptr<impl> m_impl;
+
+      public:
+        directory(std::filesystem::path root);
+
+      public:
+        std::expected<response, error> operator()(const request &) const;
+    };
 } // namespace saucer::scheme
@@ -1,17 +1,25 @@
 #pragma once
 
+#include "../stash/stash.hpp"
+
 #include <string>
 #include <memory>
+#include <vector>
 
 #include <variant>
 #include <cstdint>
 
 namespace saucer
 {
+    using function_id = std::variant<std::uint64_t, std::string>;
+
     struct function_data
     {
         std::uint64_t id;
-        std::string name;
+        function_id function;
+
+      public:
+        std::vector<stash<>> buffers;
     };
 
     struct result_data
@@ -24,8 +24,8 @@ namespace saucer::serializers::generic
         static auto serialize_args(Ts &&...);
 
       public:
-        template <typename T>
-        static auto resolve(std::promise<T>);
+        template <template <typename> typename Promise, typename T>
+        static auto resolve(Promise<T>);
     };
 } // namespace saucer::serializers::generic
 
@@ -4,6 +4,11 @@
 
 #include "../../utils/tuple.hpp"
 #include "../../utils/traits.hpp"
+#include "../../utils/base64.hpp"
+
+#include <span>
+#include <vector>
+#include <variant>
 
 #include <fmt/core.h>
 #include <fmt/ranges.h>
@@ -12,6 +17,104 @@ namespace saucer::serializers::generic
 {
     namespace impl
     {
+        using buffer  = std::vector<std::uint8_t>;
+        using buffers = std::vector<stash<>>;
+
+        template <typename T>
+        concept Binary = std::same_as<std::decay_t<T>, buffer> || //
+                         std::same_as<std::decay_t<T>, std::span<const std::uint8_t>>;
+
+        // Binary parameters may either be sent inline (as an array of numbers) or out-of-band, in which case the
+        // parameter holds the index of the respective buffer that was transferred alongside the message.
+
+        template <typename T>
+        struct wire
+        {
+            using type = T;
+        };
+
+        template <>
+        struct wire<buffer>
+        {
+            using type = std::variant<std::size_t, buffer>;
+        };
+
+        template <>
+        struct wire<stash<>>
+        {
+            using type = std::variant<std::size_t, buffer>;
+        };
+
+        template <typename T>
+        using wire_t = wire<T>::type;
+
+        template <typename T>
+        bool valid(const T &, const buffers &)
+        {
+            return true;
+        }
+
+        inline bool valid(const wire_t<buffer> &value, const buffers &buffers)
+        {
+            const auto *index = std::get_if<std::size_t>(&value);
+            return !index || *index < buffers.size();
+        }
+
+        template <typename T, typename Wire>
+        Wire &&extract(Wire &&value, buffers &)
+        {
+            return std::forward<Wire>(value);
+        }
+
+        // Buffers that were transferred out-of-band are owned by the backend, which is why only parameters that need
+        // an owning vector copy them. Views (i.e. spans and stashes) share the buffer instead.
+
+        template <std::same_as<buffer> T>
+        buffer extract(wire_t<buffer> &&value, buffers &buffers)
+        {
+            if (const auto *index = std::get_if<std::size_t>(&value); index)
+            {
+                const auto &data = buffers[*index];
+                return {data.data(), data.data() + data.size()};
+            }
+
+            return std::get<buffer>(std::move(value));
+        }
+
+        template <std::same_as<stash<>> T>
+        stash<> extract(wire_t<stash<>> &&value, buffers &buffers)
+        {
+            if (const auto *index = std::get_if<std::size_t>(&value); index)
+            {
+                return std::move(buffers[*index]);
+            }
+
+            return stash<>::from(std::get<buffer>(std::move(value)));
+        }
+
+        template <typename T, typename Wire>
+        std::expected<T, std::string> unwire(Wire &&value, buffers &buffers)
+        {
+            if constexpr (std::same_as<T, std::decay_t<Wire>>)
+            {
+                return std::forward<Wire>(value);
+            }
+            else
+            {
+                auto unpack = [&]<std::size_t... Is>(std::index_sequence<Is...>) -> std::expected<T, std::string>
+                {
+                    if (!(valid(std::get<Is>(value), buffers) && ...))
+                    {
+                        return std::unexpected{"Invalid buffer reference"};
+                    }
+
+                    return T{extract<std::tuple_element_t<Is, T>>(std::get<Is>(std::move(value)), buffers)...};
+                };
+
+                return unpack(std::make_index_sequence<std::tuple_size_v<T>>());
+            }
+        }
+
         template <typename Interface, typename T>
         std::expected<T, std::string> parse(const auto &data)
         {
@@ -37,6 +140,12 @@ namespace saucer::serializers::generic
             return Interface::serialize(std::forward<T>(data));
         }
 
+        template <typename Interface, Binary T>
+        auto serialize(T &&data)
+        {
+            return fmt::format(R"(window.saucer.internal.decode("{}"))", base64::encode(data));
+        }
+
         template <typename Interface, Arguments T>
         auto serialize(T &&data)
         {
@@ -60,12 +169,14 @@ namespace saucer::serializers::generic
         using resolver  = traits::resolver<Function>;
         using converter = resolver::converter;
         using args      = resolver::args;
+        using wire      = tuple::transform_t<args, impl::wire_t>;
 
         return [func = converter::convert(std::move(func))](std::unique_ptr<saucer::function_data> data,
                                                             serializer::executor exec) mutable
         {
-            const auto &message = *static_cast<FunctionData *>(data.get());
-            auto parsed         = impl::parse<Interface, args>(message);
+            auto &message = *static_cast<FunctionData *>(data.get());
+            auto parsed   = impl::parse<Interface, wire>(message).and_then(
+                [&message](auto &&value) { return impl::unwire<args>(std::move(value), message.buffers); });
 
             if (!parsed)
             {
@@ -102,8 +213,8 @@ namespace saucer::serializers::generic
     }
 
     template <typename FunctionData, typename ResultData, Serializer<FunctionData, ResultData> Interface>
-    template <typename T>
-    auto serializer<FunctionData, ResultData, Interface>::resolve(std::promise<T> promise)
+    template <template <typename> typename Promise, typename T>
+    auto serializer<FunctionData, ResultData, Interface>::resolve(Promise<T> promise)
     {
         return [promise = std::move(promise)](std::unique_ptr<saucer::result_data> data) mutable
         {
@@ -46,7 +46,7 @@ namespace saucer::serializers::glaze
         [[nodiscard]] std::string js_serializer() const override;
 
       public:
-        [[nodiscard]] parse_result parse(const std::string &) const override;
+        [[nodiscard]] parse_result parse(std::string_view) const override;
     };
 } // namespace saucer::serializers::glaze
 
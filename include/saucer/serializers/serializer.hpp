@@ -4,6 +4,7 @@
 
 #include "args/args.hpp"
 #include "../executor.hpp"
+#include "../utils/task.hpp"
 
 #include <concepts>
 #include <functional>
@@ -11,6 +12,7 @@
 #include <string>
 #include <memory>
 #include <future>
+#include <string_view>
 
 #include <fmt/args.h>
 
@@ -34,7 +36,7 @@ namespace saucer
         [[nodiscard]] virtual std::string js_serializer() const = 0;
 
       public:
-        [[nodiscard]] virtual parse_result parse(const std::string &) const = 0;
+        [[nodiscard]] virtual parse_result parse(std::string_view) const = 0;
     };
 
     template <class T>
@@ -53,8 +55,13 @@ namespace saucer
         { //
             T::serialize_args(make_args(10, 15, 20))
         } -> std::convertible_to<serializer::args>;
+    } && (requires {
+        { //
+            T::resolve(std::declval<completion<int>>())
+        } -> std::convertible_to<serializer::resolver>;
+    } || requires {
         { //
             T::resolve(std::declval<std::promise<int>>())
         } -> std::convertible_to<serializer::resolver>;
-    };
+    });
 } // namespace saucer
@@ -2,12 +2,15 @@
 
 #include "webview.hpp"
 #include "config.hpp"
+#include "utils/task.hpp"
 
+#include <chrono>
 #include <future>
-#include <atomic>
+#include <functional>
 
 #include <string>
 #include <memory>
+#include <optional>
 
 #include <string_view>
 
@@ -17,12 +20,16 @@ namespace saucer
     {
         struct impl;
 
+      protected:
+        struct deadline
+        {
+            std::chrono::milliseconds timeout;
+            std::move_only_function<void(std::exception_ptr)> expire;
+        };
+
       private:
         std::unique_ptr<impl> m_impl;
 
-      protected:
-        std::atomic_uint64_t m_id_counter{0};
-
       protected:
         smartview_core(std::unique_ptr<serializer>, const preferences &);
 
@@ -30,7 +37,10 @@ namespace saucer
         ~smartview_core() override;
 
       protected:
-        bool on_message(const std::string &) override;
+        bool on_message(std::string_view) override;
+        bool on_binary(stash<>) override;
+        void on_load(const state &) override;
+        void on_dom_ready() override;
 
       protected:
         void call(std::unique_ptr<function_data>);
@@ -38,7 +48,7 @@ namespace saucer
 
       protected:
         void add_function(std::string, serializer::function &&, launch);
-        void add_evaluation(serializer::resolver &&, const std::string &);
+        void add_evaluation(serializer::resolver &&, const std::string &, std::optional<deadline>);
 
       public:
         [[sc::thread_safe]] void clear_exposed();
@@ -60,7 +70,12 @@ namespace saucer
 
       public:
         template <typename Return, typename... Params>
-        [[sc::thread_safe]] [[nodiscard]] std::future<Return> evaluate(std::string_view code, Params &&...params);
+        [[sc::thread_safe]] [[nodiscard]] task<Return> evaluate(std::string_view code, Params &&...params);
+
+      public:
+        template <typename Return, typename... Params>
+        [[sc::thread_safe]] [[nodiscard]] task<Return> evaluate(std::chrono::milliseconds timeout, std::string_view code,
+                                                                Params &&...params);
     };
 } // namespace saucer
 
@@ -4,6 +4,73 @@
 
 namespace saucer
 {
+    namespace impl
+    {
+        template <typename T>
+        void settle(completion<T> &target, outcome<T> result)
+        {
+            if (!result.has_value())
+            {
+                target.set_exception(result.error());
+            }
+            else if constexpr (std::is_void_v<T>)
+            {
+                target.set_value();
+            }
+            else
+            {
+                target.set_value(std::move(result.value()));
+            }
+        }
+
+        template <typename Serializer, typename T>
+        serializer::resolver make_resolver(completion<T> source)
+        {
+            if constexpr (requires { Serializer::resolve(std::declval<completion<T>>()); })
+            {
+                return Serializer::resolve(std::move(source));
+            }
+            else
+            {
+                // Serializers that only know about std::promise settle it from within the resolver, which is why the
+                // completion can be settled from the (by then ready) future right after.
+
+                std::promise<T> promise;
+                auto future = promise.get_future();
+
+                auto resolve = [resolver = Serializer::resolve(std::move(promise)), future = std::move(future),
+                                source = std::move(source)](std::unique_ptr<result_data> data) mutable
+                {
+                    std::invoke(resolver, std::move(data));
+
+                    if (future.wait_for(std::chrono::seconds{0}) != std::future_status::ready)
+                    {
+                        return;
+                    }
+
+                    try
+                    {
+                        if constexpr (std::is_void_v<T>)
+                        {
+                            future.get();
+                            source.set_value();
+                        }
+                        else
+                        {
+                            source.set_value(future.get());
+                        }
+                    }
+                    catch (...)
+                    {
+                        source.set_exception(std::current_exception());
+                    }
+                };
+
+                return resolve;
+            }
+        }
+    } // namespace impl
+
     template <Serializer Serializer>
     smartview<Serializer>::smartview(const preferences &prefs) : smartview_core(std::make_unique<Serializer>(), prefs)
     {
@@ -19,15 +86,38 @@ namespace saucer
 
     template <Serializer Serializer>
     template <typename Return, typename... Params>
-    std::future<Return> smartview<Serializer>::evaluate(std::string_view code, Params &&...params)
+    task<Return> smartview<Serializer>::evaluate(std::string_view code, Params &&...params)
+    {
+        completion<Return> source;
+        auto rtn = source.get_task();
+
+        auto args    = Serializer::serialize_args(std::forward<Params>(params)...);
+        auto resolve = saucer::impl::make_resolver<Serializer>(std::move(source));
+
+        add_evaluation(std::move(resolve), fmt::vformat(code, args), std::nullopt);
+
+        return rtn;
+    }
+
+    template <Serializer Serializer>
+    template <typename Return, typename... Params>
+    task<Return> smartview<Serializer>::evaluate(std::chrono::milliseconds timeout, std::string_view code,
+                                                 Params &&...params)
     {
-        std::promise<Return> promise;
-        auto rtn = promise.get_future();
+        // The evaluation may either be resolved by the page or expire, whichever happens first settles the task.
+
+        auto target = std::make_shared<completion<Return>>();
+        auto rtn    = target->get_task();
+
+        completion<Return> source;
+        source.get_task().then([target](saucer::impl::outcome<Return> result)
+                               { saucer::impl::settle(*target, std::move(result)); });
 
         auto args    = Serializer::serialize_args(std::forward<Params>(params)...);
-        auto resolve = Serializer::resolve(std::move(promise));
+        auto resolve = saucer::impl::make_resolver<Serializer>(std::move(source));
+        auto expire  = [target](std::exception_ptr error) { target->set_exception(std::move(error)); };
 
-        add_evaluation(std::move(resolve), fmt::vformat(code, args));
+        add_evaluation(std::move(resolve), fmt::vformat(code, args), deadline{timeout, std::move(expire)});
 
         return rtn;
     }
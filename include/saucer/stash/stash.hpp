@@ -10,16 +10,41 @@
 
 #include <future>
 #include <variant>
+#include <optional>
+#include <filesystem>
 
 namespace saucer
 {
+    namespace fs = std::filesystem;
+
+    namespace impl
+    {
+        struct mapping
+        {
+            std::shared_ptr<const void> owner;
+            std::span<const std::uint8_t> data;
+        };
+
+        [[nodiscard]] std::optional<mapping> map(const fs::path &);
+    } // namespace impl
+
     template <typename T = std::uint8_t>
     class stash
     {
         using owning_t  = std::vector<std::remove_const_t<T>>;
         using viewing_t = std::span<std::add_const_t<T>>;
         using lazy_t    = std::shared_future<std::shared_ptr<stash<T>>>;
-        using variant_t = std::variant<owning_t, viewing_t, lazy_t>;
+        using owner_t   = std::shared_ptr<const void>;
+
+      private:
+        struct shared_t
+        {
+            owner_t owner;
+            viewing_t view;
+        };
+
+      private:
+        using variant_t = std::variant<shared_t, viewing_t, lazy_t>;
 
       private:
         variant_t m_data;
@@ -31,9 +56,17 @@ namespace saucer
         [[nodiscard]] const T *data() const;
         [[nodiscard]] std::size_t size() const;
 
+      public:
+        [[nodiscard]] stash slice(std::size_t offset, std::size_t count = std::dynamic_extent) const;
+
+      public:
+        operator viewing_t() const;
+
       public:
         [[nodiscard]] static stash from(owning_t data);
         [[nodiscard]] static stash view(viewing_t data);
+        [[nodiscard]] static stash share(owner_t owner, viewing_t data);
+        [[nodiscard]] static std::optional<stash> map(const fs::path &file);
 
       public:
         [[nodiscard]] static stash lazy(lazy_t data);
@@ -3,6 +3,7 @@
 #include "stash.hpp"
 #include "../utils/overload.hpp"
 
+#include <algorithm>
 #include <functional>
 
 namespace saucer
@@ -17,7 +18,8 @@ namespace saucer
     {
         overload visitor = {
             [](const lazy_t &data) { return data.get()->data(); },
-            [](const auto &data) { return data.data(); },
+            [](const shared_t &data) { return data.view.data(); },
+            [](const viewing_t &data) { return data.data(); },
         };
 
         return std::visit(visitor, m_data);
@@ -28,16 +30,39 @@ namespace saucer
     {
         overload visitor = {
             [](const lazy_t &data) { return data.get()->size(); },
-            [](const auto &data) { return data.size(); },
+            [](const shared_t &data) { return data.view.size(); },
+            [](const viewing_t &data) { return data.size(); },
         };
 
         return std::visit(visitor, m_data);
     }
 
+    template <typename T>
+    stash<T> stash<T>::slice(std::size_t offset, std::size_t count) const
+    {
+        offset = std::min(offset, size());
+        count  = std::min(count, size() - offset);
+
+        overload visitor = {
+            [&](const lazy_t &data) { return data.get()->slice(offset, count); },
+            [&](const shared_t &data) { return stash{shared_t{data.owner, data.view.subspan(offset, count)}}; },
+            [&](const viewing_t &data) { return stash{data.subspan(offset, count)}; },
+        };
+
+        return std::visit(visitor, m_data);
+    }
+
+    template <typename T>
+    stash<T>::operator viewing_t() const
+    {
+        return {data(), size()};
+    }
+
     template <typename T>
     stash<T> stash<T>::from(owning_t data)
     {
-        return {std::move(data)};
+        auto owner = std::make_shared<const owning_t>(std::move(data));
+        return share(owner, *owner);
     }
 
     template <typename T>
@@ -46,6 +71,28 @@ namespace saucer
         return {std::move(data)};
     }
 
+    template <typename T>
+    stash<T> stash<T>::share(owner_t owner, viewing_t data)
+    {
+        return {shared_t{std::move(owner), data}};
+    }
+
+    template <typename T>
+    std::optional<stash<T>> stash<T>::map(const fs::path &file)
+    {
+        auto mapped = impl::map(file);
+
+        if (!mapped.has_value())
+        {
+            return std::nullopt;
+        }
+
+        const auto *data = reinterpret_cast<const T *>(mapped->data.data());
+        const auto size  = mapped->data.size() / sizeof(T);
+
+        return share(std::move(mapped->owner), {data, size});
+    }
+
     template <typename T>
     stash<T> stash<T>::lazy(lazy_t data)
     {
@@ -0,0 +1,12 @@
+#pragma once
+
+#include <span>
+#include <string>
+#include <cstdint>
+
+namespace saucer::base64
+{
+    [[nodiscard]] std::string encode(std::span<const std::uint8_t>);
+} // namespace saucer::base64
+
+#include "base64.inl"
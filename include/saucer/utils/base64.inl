@@ -0,0 +1,43 @@
+#pragma once
+
+#include "base64.hpp"
+
+#include <string_view>
+
+namespace saucer::base64
+{
+    inline std::string encode(std::span<const std::uint8_t> data)
+    {
+        static constexpr std::string_view alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+        std::string rtn;
+        rtn.reserve(((data.size() + 2) / 3) * 4);
+
+        auto i = 0uz;
+
+        for (; data.size() >= i + 3; i += 3)
+        {
+            const auto chunk = (data[i] << 16) | (data[i + 1] << 8) | data[i + 2];
+
+            rtn += alphabet[(chunk >> 18) & 0x3F];
+            rtn += alphabet[(chunk >> 12) & 0x3F];
+            rtn += alphabet[(chunk >> 6) & 0x3F];
+            rtn += alphabet[chunk & 0x3F];
+        }
+
+        if (i == data.size())
+        {
+            return rtn;
+        }
+
+        const auto remaining = data.size() - i;
+        const auto chunk     = (data[i] << 16) | (remaining > 1 ? data[i + 1] << 8 : 0);
+
+        rtn += alphabet[(chunk >> 18) & 0x3F];
+        rtn += alphabet[(chunk >> 12) & 0x3F];
+        rtn += remaining > 1 ? alphabet[(chunk >> 6) & 0x3F] : '=';
+        rtn += '=';
+
+        return rtn;
+    }
+} // namespace saucer::base64
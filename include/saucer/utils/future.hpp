@@ -1,23 +1,58 @@
 #pragma once
 
+#include "task.hpp"
+#include "../app.hpp"
+#include "../webview.hpp"
+
+#include <tuple>
 #include <future>
+#include <optional>
 
 namespace saucer
 {
+    namespace impl
+    {
+        template <typename T>
+        using all_tuple_t = std::conditional_t<std::is_void_v<T>, std::tuple<>, std::tuple<T>>;
+
+        template <typename... T>
+        using all_result_t = decltype(std::tuple_cat(std::declval<all_tuple_t<T>>()...));
+    } // namespace impl
+
+    // Combining tasks does not block, the returned task completes once all of them did. It can still be destructured
+    // (`auto [a, b] = all(...)`), which waits for the result. A std::future can not notify anyone about its completion,
+    // combining futures thus waits for them in place and returns the tuple right away.
+
+    template <typename... T>
+    task<impl::all_result_t<T...>> all(task<T>...);
+
     template <typename... T>
-    auto all(std::future<T> &...);
+    impl::all_result_t<T...> all(std::future<T> &...);
 
     template <typename... T>
-    auto all(std::future<T>...);
+    impl::all_result_t<T...> all(std::future<T>...);
+
+    // Continuations of a std::future first have to wait for it, which blocks a thread of the pool until the future is
+    // ready. Tasks (e.g. the result of `evaluate`) are continued without holding any thread.
+    //
+    // Continuations run on the thread-pool by default, `launch::sync` posts them to the main thread instead. Passing
+    // `std::nullopt` runs them inline on whichever thread completes the task, which is usually the main thread: such
+    // continuations must neither block nor throw.
+
+    template <typename T, typename Callback>
+    void then(task<T>, Callback, std::optional<launch> = launch::async);
 
-    template <typename T, typename Callback, typename>
-    void then(std::future<T>, Callback &&);
+    template <typename T, typename Callback>
+    void then(std::future<T>, Callback, std::optional<launch> = launch::async);
 
     template <typename Callback>
     class then_pipe;
 
     template <typename Callback>
     then_pipe<Callback> then(Callback);
+
+    template <typename Callback>
+    then_pipe<Callback> then(Callback, std::optional<launch>);
 } // namespace saucer
 
 #include "future.inl"
@@ -6,25 +6,87 @@
 
 namespace saucer
 {
+    namespace impl
+    {
+        template <typename T>
+        task<all_tuple_t<T>> as_tuple(task<T> pending)
+        {
+            if constexpr (std::is_void_v<T>)
+            {
+                co_await pending;
+                co_return std::tuple<>{};
+            }
+            else
+            {
+                co_return std::make_tuple(co_await pending);
+            }
+        }
+
+        template <typename T, typename Callback>
+        void settle(Callback &callback, outcome<T> result)
+        {
+            if constexpr (std::invocable<Callback, outcome<T>>)
+            {
+                std::invoke(callback, std::move(result));
+            }
+            else if (!result.has_value())
+            {
+                std::rethrow_exception(result.error());
+            }
+            else if constexpr (std::is_void_v<T>)
+            {
+                std::invoke(callback);
+            }
+            else
+            {
+                std::invoke(callback, std::move(result.value()));
+            }
+        }
+
+        template <typename Callback>
+        void schedule(std::optional<launch> policy, Callback callback)
+        {
+            if (!policy.has_value())
+            {
+                return std::invoke(callback);
+            }
+
+            auto app = application::active();
+
+            if (policy.value() == launch::sync)
+            {
+                return app->post(std::move(callback));
+            }
+
+            app->pool().emplace(std::move(callback));
+        }
+    } // namespace impl
+
     template <typename... T>
-    auto all(std::future<T> &...futures)
+    task<impl::all_result_t<T...>> all(task<T>... tasks)
+    {
+        co_return std::tuple_cat(co_await impl::as_tuple(std::move(tasks))...);
+    }
+
+    template <typename... T>
+    impl::all_result_t<T...> all(std::future<T> &...futures)
     {
         return all(std::move(futures)...);
     }
 
     template <typename... T>
-    auto all(std::future<T>... futures)
+    impl::all_result_t<T...> all(std::future<T>... futures)
     {
         auto make_tuple = []<typename F>(std::future<F> future)
         {
-            if constexpr (!std::same_as<F, void>)
+            if constexpr (std::is_void_v<F>)
             {
-                return std::make_tuple(future.get());
+                future.get();
+                return std::tuple<>{};
             }
             else
             {
-                future.get();
-                return std::tuple<>();
+                return std::make_tuple(future.get());
             }
         };
 
@@ -32,34 +94,54 @@ namespace saucer
     }
 
     template <typename T, typename Callback>
-    void then(std::future<T> future, Callback callback)
+    void then(task<T> pending, Callback callback, std::optional<launch> policy)
     {
-        std::thread{[future = std::move(future), callback = std::move(callback)]() mutable
-                    {
-                        std::invoke(callback, future.get());
-                    }}
-            .detach();
+        std::move(pending).then(
+            [callback = std::move(callback), policy](impl::outcome<T> result) mutable
+            {
+                impl::schedule(policy, [callback = std::move(callback), result = std::move(result)]() mutable
+                               { impl::settle(callback, std::move(result)); });
+            });
+    }
+
+    template <typename T, typename Callback>
+    void then(std::future<T> future, Callback callback, std::optional<launch> policy)
+    {
+        then(make_task(std::move(future)), std::move(callback), policy);
     }
 
     template <typename Callback>
     class then_pipe
     {
         Callback m_callback;
+        std::optional<launch> m_policy;
 
       public:
-        then_pipe(Callback callback) : m_callback(std::move(callback)) {}
+        then_pipe(Callback callback, std::optional<launch> policy) : m_callback(std::move(callback)), m_policy(policy) {}
 
       public:
+        template <typename T>
+        friend void operator|(task<T> &&pending, then_pipe pipe)
+        {
+            then(std::move(pending), std::move(pipe.m_callback), pipe.m_policy);
+        }
+
         template <typename T>
         friend void operator|(std::future<T> &&future, then_pipe pipe)
         {
-            then(std::move(future), std::move(pipe.m_callback));
+            then(std::move(future), std::move(pipe.m_callback), pipe.m_policy);
         }
     };
 
     template <typename Callback>
     then_pipe<Callback> then(Callback callback)
     {
-        return then_pipe{std::move(callback)};
+        return then_pipe{std::move(callback), std::optional{launch::async}};
+    }
+
+    template <typename Callback>
+    then_pipe<Callback> then(Callback callback, std::optional<launch> policy)
+    {
+        return then_pipe{std::move(callback), policy};
     }
 } // namespace saucer
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <tuple>
+#include <mutex>
+#include <chrono>
+#include <memory>
+#include <future>
+#include <optional>
+#include <expected>
+#include <exception>
+#include <coroutine>
+#include <functional>
+#include <condition_variable>
+
+namespace saucer
+{
+    namespace impl
+    {
+        template <typename T>
+        using outcome = std::expected<T, std::exception_ptr>;
+
+        template <typename T>
+        struct task_state
+        {
+            std::mutex mutex;
+            std::condition_variable cv;
+
+          public:
+            std::optional<outcome<T>> result;
+            std::move_only_function<void()> continuation;
+
+          public:
+            void complete(outcome<T>);
+            bool attach(std::move_only_function<void()> &);
+        };
+
+        template <typename T>
+        struct task_promise_base;
+    } // namespace impl
+
+    template <typename T>
+    class task;
+
+    template <typename T>
+    class completion
+    {
+        std::shared_ptr<impl::task_state<T>> m_state;
+
+      public:
+        completion();
+
+      public:
+        completion(completion &&) noexcept;
+        completion &operator=(completion &&) noexcept;
+
+      public:
+        ~completion();
+
+      public:
+        template <typename... Ts>
+        void set_value(Ts &&...);
+        void set_exception(std::exception_ptr);
+
+      public:
+        [[nodiscard]] task<T> get_task() const;
+    };
+
+    template <typename T>
+    class task
+    {
+        friend class completion<T>;
+
+      private:
+        template <std::size_t I, typename... Ts>
+        friend std::tuple_element_t<I, std::tuple<Ts...>> get(const task<std::tuple<Ts...>> &);
+
+      private:
+        std::shared_ptr<impl::task_state<T>> m_state;
+
+      private:
+        task(std::shared_ptr<impl::task_state<T>>);
+
+      public:
+        struct promise_type;
+
+      public:
+        [[nodiscard]] bool valid() const;
+        [[nodiscard]] bool ready() const;
+
+      public:
+        [[sc::may_block]] void wait() const;
+        [[sc::may_block]] T get();
+
+      public:
+        template <typename Rep, typename Period>
+        [[sc::may_block]] std::future_status wait_for(const std::chrono::duration<Rep, Period> &) const;
+
+        template <typename Clock, typename Duration>
+        [[sc::may_block]] std::future_status wait_until(const std::chrono::time_point<Clock, Duration> &) const;
+
+      public:
+        template <typename Callback>
+        void then(Callback &&) &&;
+
+      public:
+        operator std::future<T>() &&;
+        [[nodiscard]] std::shared_future<T> share() &&;
+
+      public:
+        [[nodiscard]] bool await_ready() const;
+        [[nodiscard]] bool await_suspend(std::coroutine_handle<>);
+
+      public:
+        T await_resume();
+    };
+
+    template <std::size_t I, typename... Ts>
+    std::tuple_element_t<I, std::tuple<Ts...>> get(const task<std::tuple<Ts...>> &);
+
+    template <typename T>
+    task<T> make_task(std::future<T>);
+} // namespace saucer
+
+template <typename... Ts>
+struct std::tuple_size<saucer::task<std::tuple<Ts...>>> : std::integral_constant<std::size_t, sizeof...(Ts)>
+{
+};
+
+template <std::size_t I, typename... Ts>
+struct std::tuple_element<I, saucer::task<std::tuple<Ts...>>> : std::tuple_element<I, std::tuple<Ts...>>
+{
+};
+
+#include "task.inl"
@@ -0,0 +1,365 @@
+#pragma once
+
+#include "task.hpp"
+#include "../app.hpp"
+
+#include <chrono>
+
+namespace saucer
+{
+    namespace impl
+    {
+        template <typename T>
+        void task_state<T>::complete(outcome<T> value)
+        {
+            std::move_only_function<void()> callback;
+
+            {
+                std::lock_guard guard{mutex};
+
+                if (result.has_value())
+                {
+                    return;
+                }
+
+                result.emplace(std::move(value));
+                callback = std::move(continuation);
+            }
+
+            cv.notify_all();
+
+            if (!callback)
+            {
+                return;
+            }
+
+            std::invoke(callback);
+        }
+
+        template <typename T>
+        bool task_state<T>::attach(std::move_only_function<void()> &callback)
+        {
+            std::lock_guard guard{mutex};
+
+            if (result.has_value())
+            {
+                return false;
+            }
+
+            continuation = std::move(callback);
+
+            return true;
+        }
+
+        template <typename T>
+        struct task_promise_base
+        {
+            completion<T> source;
+
+          public:
+            template <typename U = T>
+            void return_value(U &&value)
+            {
+                source.set_value(std::forward<U>(value));
+            }
+        };
+
+        template <>
+        struct task_promise_base<void>
+        {
+            completion<void> source;
+
+          public:
+            void return_void()
+            {
+                source.set_value();
+            }
+        };
+    } // namespace impl
+
+    template <typename T>
+    completion<T>::completion() : m_state(std::make_shared<impl::task_state<T>>())
+    {
+    }
+
+    template <typename T>
+    completion<T>::completion(completion &&other) noexcept : m_state(std::move(other.m_state))
+    {
+    }
+
+    template <typename T>
+    completion<T> &completion<T>::operator=(completion &&other) noexcept
+    {
+        completion previous{std::move(other)};
+        std::swap(m_state, previous.m_state);
+
+        return *this;
+    }
+
+    template <typename T>
+    completion<T>::~completion()
+    {
+        if (!m_state)
+        {
+            return;
+        }
+
+        set_exception(std::make_exception_ptr(std::future_error{std::future_errc::broken_promise}));
+        m_state.reset();
+    }
+
+    template <typename T>
+    template <typename... Ts>
+    void completion<T>::set_value(Ts &&...value)
+    {
+        m_state->complete(impl::outcome<T>{std::in_place, std::forward<Ts>(value)...});
+    }
+
+    template <typename T>
+    void completion<T>::set_exception(std::exception_ptr exception)
+    {
+        m_state->complete(std::unexpected{std::move(exception)});
+    }
+
+    template <typename T>
+    task<T> completion<T>::get_task() const
+    {
+        return task<T>{m_state};
+    }
+
+    template <typename T>
+    task<T>::task(std::shared_ptr<impl::task_state<T>> state) : m_state(std::move(state))
+    {
+    }
+
+    template <typename T>
+    struct task<T>::promise_type : impl::task_promise_base<T>
+    {
+        task get_return_object()
+        {
+            return this->source.get_task();
+        }
+
+      public:
+        std::suspend_never initial_suspend() noexcept
+        {
+            return {};
+        }
+
+        std::suspend_never final_suspend() noexcept
+        {
+            return {};
+        }
+
+      public:
+        void unhandled_exception()
+        {
+            this->source.set_exception(std::current_exception());
+        }
+    };
+
+    template <typename T>
+    bool task<T>::valid() const
+    {
+        return m_state != nullptr;
+    }
+
+    template <typename T>
+    bool task<T>::ready() const
+    {
+        std::lock_guard guard{m_state->mutex};
+        return m_state->result.has_value();
+    }
+
+    template <typename T>
+    void task<T>::wait() const
+    {
+        std::unique_lock lock{m_state->mutex};
+        m_state->cv.wait(lock, [this] { return m_state->result.has_value(); });
+    }
+
+    template <typename T>
+    T task<T>::get()
+    {
+        wait();
+
+        // Just like a std::future, the task is consumed by retrieving its result.
+
+        auto consumed = std::move(*this);
+        return consumed.await_resume();
+    }
+
+    template <typename T>
+    template <typename Rep, typename Period>
+    std::future_status task<T>::wait_for(const std::chrono::duration<Rep, Period> &duration) const
+    {
+        std::unique_lock lock{m_state->mutex};
+
+        if (!m_state->cv.wait_for(lock, duration, [this] { return m_state->result.has_value(); }))
+        {
+            return std::future_status::timeout;
+        }
+
+        return std::future_status::ready;
+    }
+
+    template <typename T>
+    template <typename Clock, typename Duration>
+    std::future_status task<T>::wait_until(const std::chrono::time_point<Clock, Duration> &time) const
+    {
+        std::unique_lock lock{m_state->mutex};
+
+        if (!m_state->cv.wait_until(lock, time, [this] { return m_state->result.has_value(); }))
+        {
+            return std::future_status::timeout;
+        }
+
+        return std::future_status::ready;
+    }
+
+    template <typename T>
+    template <typename Callback>
+    void task<T>::then(Callback &&callback) &&
+    {
+        auto state = std::move(m_state);
+
+        std::move_only_function<void()> continuation = [state, callback = std::forward<Callback>(callback)]() mutable
+        {
+            std::invoke(callback, std::move(state->result.value()));
+        };
+
+        if (state->attach(continuation))
+        {
+            return;
+        }
+
+        std::invoke(continuation);
+    }
+
+    template <typename T>
+    task<T>::operator std::future<T>() &&
+    {
+        std::promise<T> promise;
+        auto rtn = promise.get_future();
+
+        std::move(*this).then(
+            [promise = std::move(promise)](impl::outcome<T> result) mutable
+            {
+                if (!result.has_value())
+                {
+                    promise.set_exception(result.error());
+                }
+                else if constexpr (std::is_void_v<T>)
+                {
+                    promise.set_value();
+                }
+                else
+                {
+                    promise.set_value(std::move(result.value()));
+                }
+            });
+
+        return rtn;
+    }
+
+    template <typename T>
+    std::shared_future<T> task<T>::share() &&
+    {
+        return std::future<T>{std::move(*this)}.share();
+    }
+
+    template <typename T>
+    bool task<T>::await_ready() const
+    {
+        return ready();
+    }
+
+    template <typename T>
+    bool task<T>::await_suspend(std::coroutine_handle<> handle)
+    {
+        std::move_only_function<void()> continuation = [handle]
+        {
+            handle.resume();
+        };
+
+        return m_state->attach(continuation);
+    }
+
+    template <typename T>
+    T task<T>::await_resume()
+    {
+        auto result = std::move(m_state->result.value());
+
+        if (!result.has_value())
+        {
+            std::rethrow_exception(result.error());
+        }
+
+        if constexpr (!std::is_void_v<T>)
+        {
+            return std::move(result.value());
+        }
+    }
+
+    template <std::size_t I, typename... Ts>
+    std::tuple_element_t<I, std::tuple<Ts...>> get(const task<std::tuple<Ts...>> &self)
+    {
+        // Allows for structured bindings (i.e. `auto [a, b] = all(...)`), which wait for the task to complete.
+
+        self.wait();
+
+        auto &result = self.m_state->result.value();
+
+        if (!result.has_value())
+        {
+            std::rethrow_exception(result.error());
+        }
+
+        return std::move(std::get<I>(result.value()));
+    }
+
+    template <typename T>
+    task<T> make_task(std::future<T> future)
+    {
+        completion<T> source;
+
+        auto rtn          = source.get_task();
+        const auto status = future.wait_for(std::chrono::seconds{0});
+
+        auto settle = [future = std::move(future), source = std::move(source)]() mutable
+        {
+            try
+            {
+                if constexpr (std::is_void_v<T>)
+                {
+                    future.get();
+                    source.set_value();
+                }
+                else
+                {
+                    source.set_value(future.get());
+                }
+            }
+            catch (...)
+            {
+                source.set_exception(std::current_exception());
+            }
+        };
+
+        // A std::future offers no way to be notified about its completion: Unless it is ready already, it is waited upon
+        // (or, when deferred, run) by a thread of the application pool, which is blocked until then. Producers that care
+        // should hand out a `task` instead, which is completed by its `completion` directly and never holds a thread.
+
+        auto app = application::active();
+
+        if (status == std::future_status::ready || !app)
+        {
+            std::invoke(settle);
+            return rtn;
+        }
+
+        app->pool().emplace(std::move(settle));
+
+        return rtn;
+    }
+} // namespace saucer
@@ -1,13 +1,21 @@
 #pragma once
 
+#include "task.hpp"
 #include "tuple.hpp"
 #include "../executor.hpp"
+#include "../stash/stash.hpp"
 
 #include <utility>
 #include <type_traits>
 
+#include <span>
+#include <vector>
+#include <cstdint>
+
 #include <tuple>
+#include <future>
 #include <expected>
+#include <exception>
 
 #include <boost/callable_traits.hpp>
 
@@ -47,7 +55,56 @@ namespace saucer::traits
         };
 
         template <typename T, typename D = std::decay_t<T>>
-        using arg_transformer_t = std::conditional_t<std::same_as<D, std::string_view>, std::string, D>;
+        struct arg_transformer
+        {
+            using type = D;
+        };
+
+        template <typename T>
+        struct arg_transformer<T, std::string_view>
+        {
+            using type = std::string;
+        };
+
+        template <typename T>
+        struct arg_transformer<T, std::span<const std::uint8_t>>
+        {
+            using type = stash<>;
+        };
+
+        template <typename T>
+        using arg_transformer_t = arg_transformer<T>::type;
+
+        template <typename R, typename E>
+        void settle(executor<R, E> &executor, saucer::impl::outcome<R> result)
+        {
+            if (result.has_value())
+            {
+                if constexpr (std::is_void_v<R>)
+                {
+                    std::invoke(executor.resolve);
+                }
+                else
+                {
+                    std::invoke(executor.resolve, std::move(result.value()));
+                }
+
+                return;
+            }
+
+            try
+            {
+                std::rethrow_exception(result.error());
+            }
+            catch (const std::exception &ex)
+            {
+                std::invoke(executor.reject, ex.what());
+            }
+            catch (...)
+            {
+                std::invoke(executor.reject, "Unknown Exception");
+            }
+        }
     } // namespace impl
 
     using apply_failure = impl::apply_info<false>;
@@ -126,6 +183,34 @@ namespace saucer::traits
         }
     };
 
+    template <typename T, typename... Ts, typename R, typename E>
+    struct converter<T, std::tuple<Ts...>, executor<R, E>, apply_failure, apply_success<task<R>>>
+    {
+        static decltype(auto) convert(T callable)
+        {
+            return [callable = std::move(callable)](Ts &&...args, auto &&executor) mutable
+            {
+                std::invoke(callable, std::forward<Ts>(args)...)
+                    .then([executor = std::forward<decltype(executor)>(executor)](auto &&result) mutable
+                          { impl::settle(executor, std::forward<decltype(result)>(result)); });
+            };
+        }
+    };
+
+    template <typename T, typename... Ts, typename R, typename E>
+    struct converter<T, std::tuple<Ts...>, executor<R, E>, apply_failure, apply_success<std::future<R>>>
+    {
+        static decltype(auto) convert(T callable)
+        {
+            return [callable = std::move(callable)](Ts &&...args, auto &&executor) mutable
+            {
+                make_task(std::invoke(callable, std::forward<Ts>(args)...))
+                    .then([executor = std::forward<decltype(executor)>(executor)](auto &&result) mutable
+                          { impl::settle(executor, std::forward<decltype(result)>(result)); });
+            };
+        }
+    };
+
     template <typename T, typename Result = result_t<T>, typename Last = tuple::last_t<args_t<T>>>
         requires(!has_reference_v<raw_args_t<T>>)
     struct resolver
@@ -162,4 +247,28 @@ namespace saucer::traits
       public:
         using converter = traits::converter<T, args, executor>;
     };
+
+    template <typename T, typename R, typename Last>
+    struct resolver<T, task<R>, Last>
+    {
+        using args     = args_t<T>;
+        using error    = std::string;
+        using result   = R;
+        using executor = saucer::executor<R, std::string>;
+
+      public:
+        using converter = traits::converter<T, args, executor>;
+    };
+
+    template <typename T, typename R, typename Last>
+    struct resolver<T, std::future<R>, Last>
+    {
+        using args     = args_t<T>;
+        using error    = std::string;
+        using result   = R;
+        using executor = saucer::executor<R, std::string>;
+
+      public:
+        using converter = traits::converter<T, args, executor>;
+    };
 } // namespace saucer::traits
@@ -9,21 +9,34 @@
 #include "script.hpp"
 
 #include "scheme.hpp"
+#include "embedded.hpp"
 #include "navigation.hpp"
 
 #include <array>
+#include <chrono>
+#include <vector>
+#include <cstddef>
 #include <cstdint>
+#include <optional>
 
 #include <filesystem>
 #include <unordered_map>
 
+#include <mutex>
 #include <string>
 #include <memory>
+#include <string_view>
 
 #include <ereignis/manager.hpp>
 
 namespace saucer
 {
+    namespace utils
+    {
+        class scheduler;
+        class script_batch;
+    } // namespace utils
+
     enum class web_event : std::uint8_t
     {
         dom_ready,
@@ -50,6 +63,29 @@ namespace saucer
     {
         stash<> content;
         std::string mime;
+
+      public:
+        scheme::encoding encoding{scheme::encoding::identity};
+        std::string etag{};
+    };
+
+    struct batch_stats
+    {
+        std::size_t batches;
+        std::size_t scripts;
+        std::size_t largest;
+    };
+
+    struct scheme_stats
+    {
+        std::size_t queued;
+        std::size_t active;
+        std::size_t peak;
+        std::size_t completed;
+
+      public:
+        std::chrono::nanoseconds waited;
+        std::chrono::nanoseconds longest;
     };
 
     using color = std::array<std::uint8_t, 4>;
@@ -77,18 +113,53 @@ namespace saucer
       private:
         events m_events;
         embedded_files m_embedded_files;
+        std::unordered_map<std::string, stash<>> m_decoded_files;
+
+      private:
+        struct embedded_slot
+        {
+            std::once_flag init;
+
+          public:
+            stash<> decoded;
+            std::string etag;
+        };
+
+        struct embedded_table
+        {
+            embedded_assets assets;
+            std::unique_ptr<embedded_slot[]> slots;
+            std::vector<bool> removed;
+        };
+
+      private:
+        std::vector<embedded_table> m_embedded_tables;
+
+      private:
+        std::shared_ptr<utils::scheduler> m_scheduler;
+        std::shared_ptr<utils::script_batch> m_batch;
 
       protected:
         std::unique_ptr<impl> m_impl;
 
       protected:
-        virtual bool on_message(const std::string &);
+        virtual bool on_message(std::string_view);
+        virtual bool on_binary(stash<>);
+        virtual void on_load(const state &);
+        virtual void on_dom_ready();
         void handle_scheme(const std::string &, scheme::resolver &&, launch);
+        void handle_scheme(const std::string &, scheme::resolver &&, scheme::limits);
+
+      private:
+        [[nodiscard]] std::expected<scheme::response, scheme::error> embedded(const scheme::request &) const;
 
       protected:
         void reject(std::uint64_t, const std::string &);
         void resolve(std::uint64_t, const std::string &);
 
+      protected:
+        void uninject(const script &);
+
       public:
         webview(const preferences &);
 
@@ -112,6 +183,10 @@ namespace saucer
         [[sc::thread_safe]] [[nodiscard]] color background() const;
         [[sc::thread_safe]] [[nodiscard]] bool force_dark_mode() const;
 
+      public:
+        [[sc::thread_safe]] [[nodiscard]] batch_stats execute_stats() const;
+        [[sc::thread_safe]] [[nodiscard]] std::optional<scheme_stats> handler_stats(const std::string &name) const;
+
       public:
         [[sc::thread_safe]] void set_dev_tools(bool enabled);
         [[sc::thread_safe]] void set_context_menu(bool enabled);
@@ -133,6 +208,7 @@ namespace saucer
 
       public:
         [[sc::thread_safe]] void embed(embedded_files files, launch policy = launch::sync);
+        [[sc::thread_safe]] void embed(embedded_assets assets, launch policy = launch::sync);
         [[sc::thread_safe]] void serve(const std::string &file);
 
       public:
@@ -149,6 +225,8 @@ namespace saucer
       public:
         template <typename T>
         [[sc::thread_safe]] void handle_scheme(const std::string &name, T &&handler, launch policy = launch::sync);
+        template <typename T>
+        [[sc::thread_safe]] void handle_scheme(const std::string &name, T &&handler, scheme::limits limits);
         [[sc::thread_safe]] void remove_scheme(const std::string &name);
 
       public:
@@ -11,4 +11,11 @@ namespace saucer
         using converter = traits::converter<T, std::tuple<scheme::request>, scheme::executor>;
         handle_scheme(name, scheme::resolver{converter::convert(std::forward<T>(handler))}, policy);
     }
+
+    template <typename T>
+    void webview::handle_scheme(const std::string &name, T &&handler, scheme::limits limits)
+    {
+        using converter = traits::converter<T, std::tuple<scheme::request>, scheme::executor>;
+        handle_scheme(name, scheme::resolver{converter::convert(std::forward<T>(handler))}, limits);
+    }
 } // namespace saucer
@@ -61,6 +61,9 @@ namespace saucer
         bool persistent_cookies{true};
         bool hardware_acceleration{true};
 
+      public:
+        bool batch_scripts{false};
+
       public:
         fs::path storage_path;
         std::string user_agent;
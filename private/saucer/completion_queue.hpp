@@ -0,0 +1,28 @@
+#pragma once
+
+#include "app.hpp"
+
+#include <memory>
+
+namespace saucer::utils
+{
+    class completion_queue
+    {
+        struct state;
+
+      private:
+        std::shared_ptr<state> m_state;
+
+      public:
+        completion_queue(application *);
+
+      public:
+        [[sc::thread_safe]] void push(application::callback_t);
+
+      public:
+        template <typename Callback>
+        [[nodiscard]] auto wrap(Callback &&) const;
+    };
+} // namespace saucer::utils
+
+#include "completion_queue.inl"
@@ -0,0 +1,19 @@
+#pragma once
+
+#include "completion_queue.hpp"
+
+#include <utility>
+#include <functional>
+
+namespace saucer::utils
+{
+    template <typename Callback>
+    auto completion_queue::wrap(Callback &&callback) const
+    {
+        return [queue = *this, callback = std::forward<Callback>(callback)]<typename... Ts>(Ts &&...args) mutable
+        {
+            queue.push([callback, ... args = std::forward<Ts>(args)]() mutable
+                       { std::invoke(callback, std::move(args)...); });
+        };
+    }
+} // namespace saucer::utils
@@ -3,7 +3,12 @@
 #include "scheme.hpp"
 
 #include "webview.hpp"
+#include "completion_queue.hpp"
 
+#include <deque>
+
+#include <QMap>
+#include <QIODevice>
 #include <QWebEngineUrlRequestJob>
 #include <QWebEngineUrlSchemeHandler>
 
@@ -15,6 +20,57 @@ namespace saucer::scheme
     {
         std::shared_ptr<lockpp::lock<QWebEngineUrlRequestJob *>> request;
         QByteArray body;
+
+      public:
+        std::size_t offset{0};
+
+      public:
+        std::string url;
+        std::string method;
+        QMap<QByteArray, QByteArray> headers;
+    };
+
+    class stash_device : public QIODevice
+    {
+        stash<> m_data;
+
+      public:
+        stash_device(stash<>);
+
+      public:
+        [[nodiscard]] bool isSequential() const override;
+        [[nodiscard]] qint64 size() const override;
+
+      protected:
+        qint64 readData(char *, qint64) override;
+        qint64 writeData(const char *, qint64) override;
+    };
+
+    class stream_device : public QIODevice
+    {
+        scheme::stream m_stream;
+
+      private:
+        std::size_t m_offset{0};
+        std::deque<stash<>> m_chunks;
+
+      public:
+        stream_device(scheme::stream);
+
+      public:
+        ~stream_device() override;
+
+      private:
+        void fill();
+
+      public:
+        [[nodiscard]] bool atEnd() const override;
+        [[nodiscard]] bool isSequential() const override;
+        [[nodiscard]] qint64 bytesAvailable() const override;
+
+      protected:
+        qint64 readData(char *, qint64) override;
+        qint64 writeData(const char *, qint64) override;
     };
 
     class handler : public QWebEngineUrlSchemeHandler
@@ -25,6 +81,9 @@ namespace saucer::scheme
         launch policy;
         scheme::resolver resolver;
 
+      private:
+        utils::completion_queue completions;
+
       public:
         handler(application *, launch, scheme::resolver);
 
@@ -38,9 +38,12 @@ namespace saucer
         std::vector<std::string> pending;
 
       public:
-        std::vector<script> permanent_scripts;
+        std::vector<script> scripts;
         std::unordered_map<std::string, scheme::handler> schemes;
 
+      public:
+        void run(const std::string &) const;
+
       public:
         template <web_event>
         void setup(webview *);
@@ -62,5 +65,6 @@ namespace saucer
 
       public slots:
         void on_message(const QString &);
+        void on_binary(const QString &);
     };
 } // namespace saucer
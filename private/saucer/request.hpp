@@ -1,7 +1,10 @@
 #pragma once
 
+#include <span>
 #include <string>
+#include <vector>
 #include <variant>
+#include <string_view>
 
 #include <cstdint>
 #include <optional>
@@ -45,8 +48,17 @@ namespace saucer::request
         std::uint64_t id;
     };
 
+    struct frame
+    {
+        std::string_view header;
+        std::vector<std::span<const std::uint8_t>> buffers;
+    };
+
     using request = std::variant<start_resize, start_drag, maximize, minimize, close, maximized, minimized>;
 
     [[nodiscard]] std::string stubs();
-    [[nodiscard]] std::optional<request> parse(const std::string &);
+    [[nodiscard]] std::string_view tag_of(std::string_view);
+    [[nodiscard]] std::optional<std::vector<std::string_view>> split(std::string_view);
+    [[nodiscard]] std::optional<frame> unpack(std::span<const std::uint8_t>);
+    [[nodiscard]] std::optional<request> parse(std::string_view);
 } // namespace saucer::request
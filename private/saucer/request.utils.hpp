@@ -3,6 +3,8 @@
 #include "request.hpp"
 
 #include <array>
+#include <optional>
+#include <functional>
 #include <string_view>
 
 #include <fmt/compile.h>
@@ -42,4 +44,24 @@ namespace saucer::request::utils
 
     template <typename T>
     static constexpr auto is_request = impl::contains<T, request>::value;
+
+    template <typename Callback>
+    std::optional<request> dispatch(std::string_view data, Callback &&callback)
+    {
+        const auto tag = tag_of(data);
+
+        if (tag.empty())
+        {
+            return std::nullopt;
+        }
+
+        auto visit = [&]<typename... Ts>(std::type_identity<std::variant<Ts...>>)
+        {
+            std::optional<request> rtn;
+            ((tag == utils::tag<Ts> && (rtn = std::invoke(callback, std::type_identity<Ts>{}), true)) || ...);
+            return rtn;
+        };
+
+        return visit(std::type_identity<request>{});
+    }
 } // namespace saucer::request::utils
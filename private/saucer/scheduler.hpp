@@ -0,0 +1,29 @@
+#pragma once
+
+#include "app.hpp"
+#include "webview.hpp"
+
+#include <string>
+#include <memory>
+#include <optional>
+
+namespace saucer::utils
+{
+    class scheduler
+    {
+        struct state;
+
+      private:
+        std::shared_ptr<state> m_state;
+
+      public:
+        scheduler(application *);
+
+      public:
+        [[sc::thread_safe]] [[nodiscard]] std::optional<scheme_stats> stats(const std::string &) const;
+
+      public:
+        void remove(const std::string &);
+        [[nodiscard]] scheme::resolver wrap(const std::string &, scheme::resolver, scheme::limits);
+    };
+} // namespace saucer::utils
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "scheme.hpp"
+#include "webview.hpp"
+
+#include <string>
+#include <optional>
+#include <expected>
+#include <filesystem>
+#include <string_view>
+
+namespace saucer::scheme::utils
+{
+    struct file_view
+    {
+        stash<> content;
+        std::string_view mime;
+
+      public:
+        scheme::encoding encoding{scheme::encoding::identity};
+        std::string_view etag;
+    };
+
+    [[nodiscard]] std::string mime(const std::filesystem::path &file);
+    [[nodiscard]] std::optional<std::string> path(std::string_view url);
+
+    [[nodiscard]] stash<> decoder(const stash<> &content, encoding encoding);
+    [[nodiscard]] std::expected<response, error> respond(const request &, const file_view &, const stash<> &decoded);
+    [[nodiscard]] std::expected<response, error> respond(const request &, const embedded_file &, const stash<> &decoded);
+} // namespace saucer::scheme::utils
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "app.hpp"
+#include "webview.hpp"
+
+#include <memory>
+#include <string>
+#include <cstddef>
+#include <functional>
+
+namespace saucer::utils
+{
+    class script_batch : public std::enable_shared_from_this<script_batch>
+    {
+        using runner = std::function<void(const std::string &)>;
+
+      private:
+        application *m_parent;
+        runner m_run;
+
+      private:
+        std::string m_code;
+        std::size_t m_size{0};
+
+      private:
+        batch_stats m_stats{};
+
+      public:
+        script_batch(application *, runner);
+
+      public:
+        [[nodiscard]] batch_stats stats() const;
+
+      public:
+        void push(const std::string &);
+        void flush();
+    };
+} // namespace saucer::utils
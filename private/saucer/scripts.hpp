@@ -17,25 +17,35 @@ namespace saucer::scripts
         internal: 
         {{
             idc: 0,
-            rpc: [],
-            send: async (message, serializer = JSON.stringify) =>
+            rpc: new Map(),
+            send: (message, serializer = JSON.stringify) =>
             {{
                 const id = ++window.saucer.internal.idc;
 
-                const promise = new Promise((resolve, reject) => {{
-                    window.saucer.internal.rpc[id] = {{
-                        reject,
-                        resolve,
-                    }};
+                message.id = id;
+                const data = serializer(message);
+
+                const promise = new Promise((resolve, reject) =>
+                {{
+                    window.saucer.internal.rpc.set(id, {{ resolve, reject }});
                 }});
 
-                await window.saucer.internal.message(serializer({{
-                    ...message,
-                    id
-                }}));
+                window.saucer.internal.message(data);
 
                 return promise;
             }},
+            settle: (id, method, value) =>
+            {{
+                const pending = window.saucer.internal.rpc.get(id);
+
+                if (!pending)
+                {{
+                    return;
+                }}
+
+                window.saucer.internal.rpc.delete(id);
+                pending[method](value);
+            }},
             fire: async (id, message) =>
             {{
                 await window.saucer.internal.message(JSON.stringify({{
@@ -107,15 +117,155 @@ namespace saucer::scripts
     )js";
 
     static constexpr std::string_view smartview_script = R"js(
-    window.saucer.internal.resolve = async (id, value) =>
+    window.saucer.internal.queue = [];
+
+    window.saucer.internal.flush = () =>
+    {{
+        const queue = window.saucer.internal.queue;
+
+        if (!queue.length)
+        {{
+            return;
+        }}
+
+        window.saucer.internal.queue = [];
+
+        window.saucer.internal.message({serializer}(queue.length === 1 ? queue[0] : queue));
+    }}
+
+    window.saucer.internal.enqueue = (message) =>
+    {{
+        if (window.saucer.internal.queue.push(message) > 1)
+        {{
+            return;
+        }}
+
+        queueMicrotask(window.saucer.internal.flush);
+    }}
+
+    window.saucer.internal.bytes = (value) =>
+    {{
+        if (value instanceof ArrayBuffer)
+        {{
+            return new Uint8Array(value);
+        }}
+
+        if (ArrayBuffer.isView(value))
+        {{
+            return new Uint8Array(value.buffer, value.byteOffset, value.byteLength);
+        }}
+
+        return undefined;
+    }}
+
+    window.saucer.internal.decode = (data) =>
     {{
-        await window.saucer.internal.message({serializer}({{
-                ["saucer:resolve"]: true,
-                id,
-                result: value === undefined ? null : value,
-        }}));
+        if (Uint8Array.fromBase64)
+        {{
+            return Uint8Array.fromBase64(data);
+        }}
+
+        const raw = atob(data);
+        const rtn = new Uint8Array(raw.length);
+
+        for (let i = 0; raw.length > i; i++)
+        {{
+            rtn[i] = raw.charCodeAt(i);
+        }}
+
+        return rtn;
+    }}
+
+    window.saucer.internal.frame = (header, buffers) =>
+    {{
+        const encoded = new TextEncoder().encode(header);
+        const size    = buffers.reduce((size, buffer) => size + 4 + buffer.byteLength, 4 + encoded.byteLength);
+
+        const rtn  = new Uint8Array(size);
+        const view = new DataView(rtn.buffer);
+
+        let offset = 0;
+
+        for (const buffer of [encoded, ...buffers])
+        {{
+            view.setUint32(offset, buffer.byteLength, true);
+            rtn.set(buffer, offset + 4);
+
+            offset += 4 + buffer.byteLength;
+        }}
+
+        return rtn;
+    }}
+
+    window.saucer.internal.resolve = (id, value) =>
+    {{
+        const bytes = window.saucer.internal.bytes(value);
+
+        window.saucer.internal.enqueue({{
+            ["saucer:resolve"]: true,
+            id,
+            result: bytes ? Array.from(bytes) : (value === undefined ? null : value),
+        }});
     }}
     
+    window.saucer.internal.ids     = new Map();
+    window.saucer.internal.exposed = Object.create(null);
+
+    window.saucer.internal.invoke = (func, params) =>
+    {{
+        const id = ++window.saucer.internal.idc;
+
+        const promise = new Promise((resolve, reject) =>
+        {{
+            window.saucer.internal.rpc.set(id, {{ resolve, reject }});
+        }});
+
+        const buffers = [];
+        const binary  = window.saucer.internal.binary;
+
+        const message = {{
+            ["saucer:call"]: true,
+            id,
+            function: func,
+            params: params.map(param =>
+            {{
+                const bytes = window.saucer.internal.bytes(param);
+
+                if (!bytes)
+                {{
+                    return param;
+                }}
+
+                return binary ? buffers.push(bytes) - 1 : Array.from(bytes);
+            }}),
+        }};
+
+        if (!buffers.length)
+        {{
+            window.saucer.internal.enqueue(message);
+            return promise;
+        }}
+
+        // Binary messages bypass the queue, which is why we flush it beforehand to retain the order of calls.
+
+        window.saucer.internal.flush();
+        binary(window.saucer.internal.frame({serializer}(message), buffers));
+
+        return promise;
+    }}
+
+    window.saucer.internal.register = (name, id) =>
+    {{
+        window.saucer.internal.ids.set(name, id);
+        window.saucer.internal.exposed[name] = (...params) => window.saucer.internal.invoke(id, params);
+    }}
+
+    window.saucer.internal.unregister = (name) =>
+    {{
+        window.saucer.internal.ids.delete(name);
+        delete window.saucer.internal.exposed[name];
+    }}
+
     window.saucer.call = async (name, params) =>
     {{
         if (!Array.isArray(params))
@@ -128,15 +278,12 @@ namespace saucer::scripts
             throw 'Bad name, expected string';
         }}
 
-        return window.saucer.internal.send({{
-            ["saucer:call"]: true,
-            name,
-            params,
-        }}, {serializer});
+        const key = String(name);
+        return window.saucer.internal.invoke(window.saucer.internal.ids.get(key) ?? key, params);
     }}
 
-    window.saucer.exposed = new Proxy({{}}, {{
-        get: (_, prop) => (...args) => window.saucer.call(prop, args),
+    window.saucer.exposed = new Proxy(window.saucer.internal.exposed, {{
+        get: (target, prop) => target[prop] ?? (target[prop] = (...params) => window.saucer.call(prop, params)),
     }});
     )js";
 } // namespace saucer::scripts
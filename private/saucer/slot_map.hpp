@@ -0,0 +1,42 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <optional>
+
+namespace saucer::utils
+{
+    template <typename T>
+    class slot_map
+    {
+        struct slot
+        {
+            std::uint32_t generation{0};
+            std::optional<T> value;
+        };
+
+      public:
+        using id = std::uint64_t;
+
+      private:
+        static constexpr std::uint32_t generation_mask = (1u << 21) - 1;
+
+      private:
+        std::vector<slot> m_slots;
+        std::vector<std::uint32_t> m_free;
+
+      public:
+        [[nodiscard]] id emplace(T value);
+        [[nodiscard]] std::optional<T> take(id);
+
+      public:
+        template <typename Predicate>
+        [[nodiscard]] std::vector<T> take_if(Predicate &&);
+
+      private:
+        [[nodiscard]] static id make_id(std::uint32_t index, std::uint32_t generation);
+        [[nodiscard]] std::optional<T> release(std::uint32_t index);
+    };
+} // namespace saucer::utils
+
+#include "slot_map.inl"
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "slot_map.hpp"
+
+#include <utility>
+#include <functional>
+
+namespace saucer::utils
+{
+    template <typename T>
+    slot_map<T>::id slot_map<T>::make_id(std::uint32_t index, std::uint32_t generation)
+    {
+        // Ids are handed to JavaScript, which represents numbers as doubles. We thus keep them within 53 bits: the lower
+        // 32 bits address the slot, the upper 21 bits hold its generation, which invalidates ids of reused slots.
+
+        return (static_cast<id>(generation & generation_mask) << 32) | index;
+    }
+
+    template <typename T>
+    std::optional<T> slot_map<T>::release(std::uint32_t index)
+    {
+        auto &slot = m_slots[index];
+        auto rtn   = std::exchange(slot.value, std::nullopt);
+
+        slot.generation++;
+        m_free.emplace_back(index);
+
+        return rtn;
+    }
+
+    template <typename T>
+    slot_map<T>::id slot_map<T>::emplace(T value)
+    {
+        if (m_free.empty())
+        {
+            m_free.emplace_back(static_cast<std::uint32_t>(m_slots.size()));
+            m_slots.emplace_back();
+        }
+
+        const auto index = m_free.back();
+        m_free.pop_back();
+
+        auto &slot = m_slots[index];
+        slot.value.emplace(std::move(value));
+
+        return make_id(index, slot.generation);
+    }
+
+    template <typename T>
+    std::optional<T> slot_map<T>::take(id id)
+    {
+        const auto index = static_cast<std::uint32_t>(id);
+
+        if (index >= m_slots.size())
+        {
+            return std::nullopt;
+        }
+
+        const auto &slot = m_slots[index];
+
+        if (!slot.value || make_id(index, slot.generation) != id)
+        {
+            return std::nullopt;
+        }
+
+        return release(index);
+    }
+
+    template <typename T>
+    template <typename Predicate>
+    std::vector<T> slot_map<T>::take_if(Predicate &&predicate)
+    {
+        std::vector<T> rtn;
+
+        for (auto index = 0u; m_slots.size() > index; index++)
+        {
+            auto &slot = m_slots[index];
+
+            if (!slot.value || !std::invoke(predicate, std::as_const(*slot.value)))
+            {
+                continue;
+            }
+
+            rtn.emplace_back(std::move(*release(index)));
+        }
+
+        return rtn;
+    }
+} // namespace saucer::utils
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <mutex>
+#include <memory>
+#include <atomic>
+
+namespace saucer::utils
+{
+    template <typename T>
+    class snapshot
+    {
+        using ptr = std::shared_ptr<const T>;
+
+      private:
+#ifdef __cpp_lib_atomic_shared_ptr
+        std::atomic<ptr> m_data;
+#else
+        ptr m_data;
+        mutable std::mutex m_read_mutex;
+#endif
+
+      private:
+        std::mutex m_write_mutex;
+
+      public:
+        snapshot();
+
+      public:
+        [[nodiscard]] ptr load() const;
+
+      public:
+        template <typename Callback>
+        void update(Callback &&);
+    };
+} // namespace saucer::utils
+
+#include "snapshot.inl"
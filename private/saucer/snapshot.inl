@@ -0,0 +1,44 @@
+#pragma once
+
+#include "snapshot.hpp"
+
+#include <functional>
+
+namespace saucer::utils
+{
+    template <typename T>
+    snapshot<T>::snapshot() : m_data(std::make_shared<const T>())
+    {
+    }
+
+    template <typename T>
+    snapshot<T>::ptr snapshot<T>::load() const
+    {
+#ifdef __cpp_lib_atomic_shared_ptr
+        return m_data.load(std::memory_order_acquire);
+#else
+        const std::lock_guard guard{m_read_mutex};
+        return m_data;
+#endif
+    }
+
+    template <typename T>
+    template <typename Callback>
+    void snapshot<T>::update(Callback &&callback)
+    {
+        // Writers are serialized and work on a private copy, which is then published in one step.
+        // Readers keep using the snapshot they loaded until they drop it.
+
+        const std::lock_guard guard{m_write_mutex};
+
+        auto copy = std::make_shared<T>(*load());
+        std::invoke(std::forward<Callback>(callback), *copy);
+
+#ifdef __cpp_lib_atomic_shared_ptr
+        m_data.store(std::move(copy), std::memory_order_release);
+#else
+        const std::lock_guard read_guard{m_read_mutex};
+        m_data = std::move(copy);
+#endif
+    }
+} // namespace saucer::utils
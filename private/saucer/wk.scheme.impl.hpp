@@ -4,6 +4,7 @@
 
 #include "webview.hpp"
 #include "cocoa.utils.hpp"
+#include "completion_queue.hpp"
 
 #import <WebKit/WebKit.h>
 #include <lockpp/lock.hpp>
@@ -18,6 +19,12 @@ namespace saucer::scheme
 
       public:
         task_ref task;
+        std::size_t offset{0};
+
+      public:
+        std::string url;
+        std::string method;
+        std::optional<std::map<std::string, std::string>> headers;
     };
 
     struct callback
@@ -27,6 +34,15 @@ namespace saucer::scheme
       public:
         launch policy;
         scheme::resolver resolver;
+
+      public:
+        utils::completion_queue completions;
+    };
+
+    struct task_entry
+    {
+        task_ref task;
+        std::shared_ptr<scheme::stream> stream;
     };
 
     void init_objc();
@@ -36,7 +52,7 @@ namespace saucer::scheme
 {
   @public
     std::unordered_map<WKWebView *, saucer::scheme::callback> m_callbacks;
-    lockpp::lock<std::unordered_map<NSUInteger, saucer::scheme::task_ref>> m_tasks;
+    lockpp::lock<std::unordered_map<NSUInteger, saucer::scheme::task_entry>> m_tasks;
 }
 - (void)add_callback:(saucer::scheme::callback)callback webview:(WKWebView *)instance;
 - (void)del_callback:(WKWebView *)instance;
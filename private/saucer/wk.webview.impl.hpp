@@ -34,12 +34,15 @@ namespace saucer
         bool context_menu{true};
 
       public:
-        std::vector<script> permanent_scripts;
+        std::vector<script> scripts;
 
       public:
         bool dom_loaded{false};
         std::vector<std::string> pending;
 
+      public:
+        void run(const std::string &) const;
+
       public:
         template <web_event>
         void setup(webview *);
@@ -4,14 +4,35 @@
 
 #include "webview.hpp"
 #include "gtk.utils.hpp"
+#include "completion_queue.hpp"
+
+#include <vector>
 
 #include <webkit/webkit.h>
+#include <lockpp/lock.hpp>
 
 namespace saucer::scheme
 {
     struct request::impl
     {
         utils::g_object_ptr<WebKitURISchemeRequest> request;
+        utils::g_object_ptr<GInputStream> body;
+
+      public:
+        std::string url;
+        std::string method;
+    };
+
+    struct stream_state
+    {
+        scheme::stream source;
+
+      public:
+        std::optional<stash<>> pending;
+        std::size_t offset;
+
+      public:
+        std::shared_ptr<lockpp::lock<std::vector<GSource *>>> waiting;
     };
 
     struct callback
@@ -21,6 +42,9 @@ namespace saucer::scheme
       public:
         launch policy;
         scheme::resolver resolver;
+
+      public:
+        utils::completion_queue completions;
     };
 
     class handler
@@ -24,7 +24,7 @@ namespace saucer
 
       public:
         bool context_menu{true};
-        std::vector<std::pair<script_ptr, bool>> scripts;
+        std::vector<std::pair<script_ptr, script>> scripts;
 
       public:
         bool dom_loaded{false};
@@ -33,6 +33,9 @@ namespace saucer
       public:
         utils::g_object_ptr<WebKitSettings> settings;
 
+      public:
+        void run(const std::string &) const;
+
       public:
         template <web_event>
         void setup(webview *);
@@ -2,6 +2,10 @@
 
 #include "scheme.hpp"
 
+#include <map>
+#include <string>
+#include <optional>
+
 #include <wrl.h>
 #include <WebView2.h>
 
@@ -13,5 +17,10 @@ namespace saucer::scheme
     {
         ComPtr<ICoreWebView2WebResourceRequest> request;
         ComPtr<IStream> body;
+
+      public:
+        std::string url;
+        std::string method;
+        std::optional<std::map<std::string, std::string>> headers;
     };
 } // namespace saucer::scheme
@@ -52,6 +52,9 @@ namespace saucer
         void create_webview(const std::shared_ptr<application> &, HWND, preferences);
         HRESULT scheme_handler(ICoreWebView2WebResourceRequestedEventArgs *, webview *);
 
+      public:
+        void run(const std::string &) const;
+
       public:
         template <web_event>
         void setup(webview *);
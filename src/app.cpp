@@ -16,6 +16,11 @@ namespace saucer
         return m_pool;
     }
 
+    std::size_t application::threads() const
+    {
+        return m_threads;
+    }
+
     std::shared_ptr<application> application::init(const options &options)
     {
         auto locked = instance().write();
@@ -48,7 +48,9 @@ namespace saucer
         auto *const data = [rep representationUsingType:NSBitmapImageFileTypePNG properties:[NSDictionary dictionary]];
 
         const auto *raw = reinterpret_cast<const std::uint8_t *>(data.bytes);
-        return stash<>::from({raw, raw + data.length});
+        auto owner      = std::make_shared<utils::objc_ptr<NSData>>(utils::objc_ptr<NSData>::ref(data));
+
+        return stash<>::share(std::move(owner), {raw, raw + data.length});
     }
 
     void icon::save(const fs::path &path) const
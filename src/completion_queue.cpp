@@ -0,0 +1,58 @@
+#include "completion_queue.hpp"
+
+#include <vector>
+#include <utility>
+
+#include <lockpp/lock.hpp>
+
+namespace saucer::utils
+{
+    struct completion_queue::state
+    {
+        application *app;
+
+      public:
+        lockpp::lock<std::vector<application::callback_t>> pending;
+
+      public:
+        void drain();
+    };
+
+    void completion_queue::state::drain()
+    {
+        auto callbacks = std::exchange(pending.write().value(), {});
+
+        for (auto &callback : callbacks)
+        {
+            std::invoke(callback);
+        }
+    }
+
+    completion_queue::completion_queue(application *app) : m_state(std::make_shared<state>())
+    {
+        m_state->app = app;
+    }
+
+    void completion_queue::push(application::callback_t callback)
+    {
+        if (m_state->app->thread_safe())
+        {
+            return std::invoke(callback);
+        }
+
+        // Only the first completion of a batch wakes up the main loop, everything that arrives before the drain runs is
+        // picked up by that same wakeup.
+
+        {
+            auto pending = m_state->pending.write();
+            pending->emplace_back(std::move(callback));
+
+            if (pending->size() > 1)
+            {
+                return;
+            }
+        }
+
+        m_state->app->post([state = m_state] { state->drain(); });
+    }
+} // namespace saucer::utils
@@ -0,0 +1,113 @@
+#include "scheme.hpp"
+
+#ifdef SAUCER_COMPRESSION
+#include <zlib.h>
+#include <brotli/decode.h>
+#endif
+
+namespace saucer::scheme
+{
+#ifdef SAUCER_COMPRESSION
+    static constexpr auto chunk_size = 64uz * 1024;
+
+    static std::optional<stash<>> inflate(const stash<> &data)
+    {
+        z_stream stream{};
+
+        // Adding 32 to the window bits enables automatic detection of gzip and zlib headers.
+        if (inflateInit2(&stream, MAX_WBITS + 32) != Z_OK)
+        {
+            return std::nullopt;
+        }
+
+        std::vector<std::uint8_t> rtn;
+        rtn.reserve(data.size() * 4);
+
+        stream.next_in  = const_cast<Bytef *>(data.data());
+        stream.avail_in = static_cast<uInt>(data.size());
+
+        auto status = Z_OK;
+
+        while (status == Z_OK)
+        {
+            const auto offset = rtn.size();
+            rtn.resize(offset + chunk_size);
+
+            stream.next_out  = rtn.data() + offset;
+            stream.avail_out = static_cast<uInt>(chunk_size);
+
+            status = ::inflate(&stream, Z_NO_FLUSH);
+            rtn.resize(offset + chunk_size - stream.avail_out);
+        }
+
+        inflateEnd(&stream);
+
+        if (status != Z_STREAM_END)
+        {
+            return std::nullopt;
+        }
+
+        rtn.shrink_to_fit();
+
+        return stash<>::from(std::move(rtn));
+    }
+
+    static std::optional<stash<>> unbrotli(const stash<> &data)
+    {
+        auto *const state = BrotliDecoderCreateInstance(nullptr, nullptr, nullptr);
+
+        if (!state)
+        {
+            return std::nullopt;
+        }
+
+        std::vector<std::uint8_t> rtn;
+        rtn.reserve(data.size() * 4);
+
+        const auto *input = data.data();
+        auto available    = data.size();
+
+        auto status = BROTLI_DECODER_RESULT_NEEDS_MORE_OUTPUT;
+
+        while (status == BROTLI_DECODER_RESULT_NEEDS_MORE_OUTPUT)
+        {
+            const auto offset = rtn.size();
+            rtn.resize(offset + chunk_size);
+
+            auto *output   = rtn.data() + offset;
+            auto remaining = chunk_size;
+
+            status = BrotliDecoderDecompressStream(state, &available, &input, &remaining, &output, nullptr);
+            rtn.resize(offset + chunk_size - remaining);
+        }
+
+        BrotliDecoderDestroyInstance(state);
+
+        if (status != BROTLI_DECODER_RESULT_SUCCESS)
+        {
+            return std::nullopt;
+        }
+
+        rtn.shrink_to_fit();
+
+        return stash<>::from(std::move(rtn));
+    }
+#endif
+
+    std::optional<stash<>> decompress(const stash<> &data, encoding encoding)
+    {
+        switch (encoding)
+        {
+        case encoding::identity:
+            return data;
+#ifdef SAUCER_COMPRESSION
+        case encoding::gzip:
+            return inflate(data);
+        case encoding::brotli:
+            return unbrotli(data);
+#endif
+        default:
+            return std::nullopt;
+        }
+    }
+} // namespace saucer::scheme
@@ -30,17 +30,26 @@ struct glz::meta<T>
 
 namespace saucer
 {
-    static constexpr auto opts = glz::opts{.error_on_unknown_keys = true, .error_on_missing_keys = true};
+    static constexpr auto opts = glz::opts{
+        .null_terminated       = false,
+        .error_on_unknown_keys = true,
+        .error_on_missing_keys = true,
+    };
 
-    std::optional<request::request> request::parse(const std::string &data)
+    std::optional<request::request> request::parse(std::string_view data)
     {
-        request rtn{};
-
-        if (auto err = glz::read<opts>(rtn, data); err)
+        auto parse = [&data]<typename T>(std::type_identity<T>) -> std::optional<T>
         {
-            return std::nullopt;
-        }
+            T rtn{};
+
+            if (auto err = glz::read<opts>(rtn, data); err)
+            {
+                return std::nullopt;
+            }
+
+            return rtn;
+        };
 
-        return rtn;
+        return utils::dispatch(data, parse);
     }
 } // namespace saucer
@@ -1,6 +1,6 @@
 #include "serializers/glaze/glaze.hpp"
 
-#include <optional>
+#include "request.hpp"
 
 template <>
 struct glz::meta<saucer::serializers::glaze::function_data>
@@ -9,7 +9,7 @@ struct glz::meta<saucer::serializers::glaze::function_data>
     static constexpr auto value = object(  //
         "saucer:call", skip{},             //
         "id", &T::id,                      //
-        "name", &T::name,                  //
+        "function", &T::function,          //
         "params", glz::escaped<&T::params> //
     );
 };
@@ -28,6 +28,7 @@ struct glz::meta<saucer::serializers::glaze::result_data>
 namespace saucer::serializers::glaze
 {
     static constexpr auto opts = glz::opts{
+        .null_terminated       = false,
         .error_on_unknown_keys = true,
         .error_on_missing_keys = true,
         .raw_string            = false,
@@ -46,28 +47,30 @@ namespace saucer::serializers::glaze
     }
 
     template <typename T>
-    std::optional<T> parse_as(const std::string &buffer)
+    serializer::parse_result parse_as(std::string_view buffer)
     {
         T value{};
 
         if (auto err = glz::read<opts>(value, buffer); err)
         {
-            return std::nullopt;
+            return std::monostate{};
         }
 
-        return value;
+        return std::make_unique<T>(std::move(value));
     }
 
-    serializer::parse_result serializer::parse(const std::string &data) const
+    serializer::parse_result serializer::parse(std::string_view data) const
     {
-        if (auto res = parse_as<function_data>(data); res.has_value())
+        const auto tag = request::tag_of(data);
+
+        if (tag == "saucer:call")
         {
-            return std::make_unique<function_data>(res.value());
+            return parse_as<function_data>(data);
         }
 
-        if (auto res = parse_as<result_data>(data); res.has_value())
+        if (tag == "saucer:resolve")
         {
-            return std::make_unique<result_data>(res.value());
+            return parse_as<result_data>(data);
         }
 
         return std::monostate{};
@@ -46,12 +46,12 @@ namespace saucer
             return stash<>::empty();
         }
 
-        const auto bytes = utils::g_bytes_ptr{gdk_texture_save_to_png_bytes(m_impl->texture.get())};
+        auto bytes = std::shared_ptr<GBytes>{gdk_texture_save_to_png_bytes(m_impl->texture.get()), g_bytes_unref};
 
         gsize size{};
         const auto *data = reinterpret_cast<const std::uint8_t *>(g_bytes_get_data(bytes.get(), &size));
 
-        return stash<>::from({data, data + size});
+        return stash<>::share(std::move(bytes), {data, data + size});
     }
 
     void icon::save(const fs::path &path) const
@@ -0,0 +1,484 @@
+#include "pack.hpp"
+#include "scheme.utils.hpp"
+
+#include <bit>
+#include <list>
+#include <array>
+#include <ranges>
+#include <vector>
+#include <cstring>
+#include <fstream>
+#include <algorithm>
+#include <unordered_map>
+
+#include <lockpp/lock.hpp>
+
+namespace saucer
+{
+    namespace format
+    {
+        // A pack is laid out as follows, all integers are little endian:
+        // [header] [entry...] [strings...] [padding] [content, padding...]
+        // Entries are sorted by name and every content blob starts at an `alignment`-byte boundary.
+
+        static constexpr std::array<char, 8> magic = {'S', 'A', 'U', 'C', 'E', 'R', 'P', 'K'};
+
+        static constexpr std::uint32_t version = 1;
+        static constexpr std::size_t alignment = 16;
+
+        struct header
+        {
+            std::array<char, 8> magic;
+            std::uint32_t version;
+            std::uint32_t count;
+            std::uint64_t entries;
+        };
+
+        struct entry
+        {
+            std::uint64_t name;
+            std::uint64_t mime;
+            std::uint64_t etag;
+            std::uint64_t offset;
+            std::uint64_t size;
+
+          public:
+            std::uint32_t name_size;
+            std::uint16_t mime_size;
+            std::uint8_t etag_size;
+            scheme::encoding encoding;
+        };
+
+        static_assert(sizeof(header) == 24 && std::is_trivially_copyable_v<header>);
+        static_assert(sizeof(entry) == 48 && std::is_trivially_copyable_v<entry>);
+
+        static constexpr bool contains(std::size_t total, std::uint64_t offset, std::uint64_t size)
+        {
+            return offset <= total && size <= total - offset;
+        }
+
+        static constexpr bool known(scheme::encoding encoding)
+        {
+            switch (encoding)
+            {
+            case scheme::encoding::identity:
+            case scheme::encoding::gzip:
+            case scheme::encoding::brotli:
+                return true;
+            }
+
+            return false;
+        }
+    } // namespace format
+
+    struct asset_pack::impl
+    {
+        using file_view = scheme::utils::file_view;
+
+      public:
+        struct cache
+        {
+            using entry = std::pair<std::size_t, stash<>>;
+
+          public:
+            std::list<entry> entries;
+            std::unordered_map<std::size_t, std::list<entry>::iterator> lookup;
+
+          public:
+            std::size_t size{0};
+        };
+
+      public:
+        // Decoded assets are only kept around up to the given amount of bytes, the least recently used ones are dropped
+        // first. Assets that exceed the budget on their own are decoded for every request that needs them.
+
+        static constexpr std::size_t budget = 32uz * 1024 * 1024;
+
+      public:
+        stash<> data{stash<>::empty()};
+
+      public:
+        std::size_t count{0};
+        std::size_t entries{0};
+
+      public:
+        lockpp::lock<cache> decoded;
+
+      public:
+        [[nodiscard]] bool validate() const;
+
+      public:
+        [[nodiscard]] format::entry entry(std::size_t index) const;
+        [[nodiscard]] std::string_view string(std::uint64_t offset, std::size_t size) const;
+
+      public:
+        [[nodiscard]] file_view file(const format::entry &) const;
+        [[nodiscard]] std::optional<std::size_t> find(std::string_view name) const;
+        [[nodiscard]] stash<> decode(std::size_t index, const file_view &file);
+    };
+
+    bool asset_pack::impl::validate() const
+    {
+        const auto total = data.size();
+
+        if (!format::contains(total, entries, count * sizeof(format::entry)))
+        {
+            return false;
+        }
+
+        std::string_view previous;
+
+        for (auto i = 0uz; count > i; ++i)
+        {
+            const auto current = entry(i);
+
+            if (!format::contains(total, current.name, current.name_size) ||
+                !format::contains(total, current.mime, current.mime_size) ||
+                !format::contains(total, current.etag, current.etag_size) ||
+                !format::contains(total, current.offset, current.size) || !format::known(current.encoding))
+            {
+                return false;
+            }
+
+            const auto name = string(current.name, current.name_size);
+
+            if (i > 0 && name <= previous)
+            {
+                return false;
+            }
+
+            previous = name;
+        }
+
+        return true;
+    }
+
+    format::entry asset_pack::impl::entry(std::size_t index) const
+    {
+        format::entry rtn{};
+        std::memcpy(&rtn, data.data() + entries + (index * sizeof(format::entry)), sizeof(format::entry));
+
+        return rtn;
+    }
+
+    std::string_view asset_pack::impl::string(std::uint64_t offset, std::size_t size) const
+    {
+        return {reinterpret_cast<const char *>(data.data() + offset), size};
+    }
+
+    asset_pack::impl::file_view asset_pack::impl::file(const format::entry &entry) const
+    {
+        return {
+            .content  = data.slice(entry.offset, entry.size),
+            .mime     = string(entry.mime, entry.mime_size),
+            .encoding = entry.encoding,
+            .etag     = string(entry.etag, entry.etag_size),
+        };
+    }
+
+    std::optional<std::size_t> asset_pack::impl::find(std::string_view name) const
+    {
+        auto project = [this](std::size_t index)
+        {
+            const auto current = entry(index);
+            return string(current.name, current.name_size);
+        };
+
+        const auto indices = std::views::iota(0uz, count);
+        const auto it      = std::ranges::lower_bound(indices, name, {}, project);
+
+        if (it == indices.end() || project(*it) != name)
+        {
+            return std::nullopt;
+        }
+
+        return *it;
+    }
+
+    stash<> asset_pack::impl::decode(std::size_t index, const file_view &file)
+    {
+        if (auto locked = decoded.write(); locked->lookup.contains(index))
+        {
+            const auto it = locked->lookup.at(index);
+            locked->entries.splice(locked->entries.begin(), locked->entries, it);
+
+            return it->second;
+        }
+
+        auto rtn = scheme::decompress(file.content, file.encoding).value_or(stash<>::empty());
+
+        if (rtn.size() > budget)
+        {
+            return rtn;
+        }
+
+        auto locked = decoded.write();
+
+        if (locked->lookup.contains(index))
+        {
+            return rtn;
+        }
+
+        locked->entries.emplace_front(index, rtn);
+        locked->lookup.emplace(index, locked->entries.begin());
+        locked->size += rtn.size();
+
+        while (locked->size > budget)
+        {
+            const auto &[evicted, content] = locked->entries.back();
+
+            locked->size -= content.size();
+            locked->lookup.erase(evicted);
+
+            locked->entries.pop_back();
+        }
+
+        return rtn;
+    }
+
+    asset_pack::asset_pack() : m_impl(std::make_shared<impl>()) {}
+
+    std::size_t asset_pack::size() const
+    {
+        return m_impl->count;
+    }
+
+    std::optional<embedded_file> asset_pack::find(std::string_view name) const
+    {
+        const auto index = m_impl->find(name);
+
+        if (!index.has_value())
+        {
+            return std::nullopt;
+        }
+
+        const auto file = m_impl->file(m_impl->entry(index.value()));
+
+        return embedded_file{
+            .content  = file.content,
+            .mime     = std::string{file.mime},
+            .encoding = file.encoding,
+            .etag     = std::string{file.etag},
+        };
+    }
+
+    std::expected<scheme::response, scheme::error> asset_pack::operator()(const scheme::request &request) const
+    {
+        const auto path = scheme::utils::path(request.url_view());
+
+        if (!path.has_value())
+        {
+            return std::unexpected{scheme::error::invalid};
+        }
+
+        const auto index = m_impl->find(path.value());
+
+        if (!index.has_value())
+        {
+            return std::unexpected{scheme::error::not_found};
+        }
+
+        const auto file   = m_impl->file(m_impl->entry(index.value()));
+        const auto decode = file.encoding != scheme::encoding::identity && !request.accepts(file.encoding);
+
+        // Only clients that do not accept the encoding of an asset need it decoded, everyone else receives it as is.
+
+        const auto decoded = decode ? m_impl->decode(index.value(), file) : stash<>::empty();
+
+        return scheme::utils::respond(request, file, decoded);
+    }
+
+    std::optional<asset_pack> asset_pack::open(const fs::path &file)
+    {
+        if constexpr (std::endian::native != std::endian::little)
+        {
+            return std::nullopt;
+        }
+
+        auto data = stash<>::map(file);
+
+        if (!data.has_value() || data->size() < sizeof(format::header))
+        {
+            return std::nullopt;
+        }
+
+        format::header header{};
+        std::memcpy(&header, data->data(), sizeof(format::header));
+
+        if (header.magic != format::magic || header.version != format::version)
+        {
+            return std::nullopt;
+        }
+
+        asset_pack rtn;
+
+        rtn.m_impl->data    = std::move(data.value());
+        rtn.m_impl->count   = header.count;
+        rtn.m_impl->entries = header.entries;
+
+        if (!rtn.m_impl->validate())
+        {
+            return std::nullopt;
+        }
+
+        return rtn;
+    }
+
+    bool asset_pack::create(const fs::path &directory, const fs::path &output)
+    {
+        if constexpr (std::endian::native != std::endian::little)
+        {
+            return false;
+        }
+
+        struct source
+        {
+            std::string name;
+            stash<> content;
+            scheme::encoding encoding;
+        };
+
+        std::error_code ec{};
+        std::vector<source> sources;
+
+        // Precompressed siblings (e.g. "index.js.br" next to "index.js") are stored in place of the original file
+
+        static constexpr auto variants = std::to_array<std::pair<std::string_view, scheme::encoding>>({
+            {".br", scheme::encoding::brotli},
+            {".gz", scheme::encoding::gzip},
+        });
+
+        for (const auto &item : fs::recursive_directory_iterator{directory, ec})
+        {
+            if (!item.is_regular_file())
+            {
+                continue;
+            }
+
+            const auto &path = item.path();
+            const auto name  = path.lexically_relative(directory).generic_string();
+
+            auto original = [&](const auto &variant)
+            {
+                return name.ends_with(variant.first) && fs::is_regular_file(fs::path{path}.replace_extension());
+            };
+
+            if (std::ranges::any_of(variants, original))
+            {
+                continue;
+            }
+
+            auto file     = path;
+            auto encoding = scheme::encoding::identity;
+
+            for (const auto &[extension, variant] : variants)
+            {
+                auto compressed = fs::path{path} += extension;
+
+                if (!fs::is_regular_file(compressed))
+                {
+                    continue;
+                }
+
+                file     = std::move(compressed);
+                encoding = variant;
+
+                break;
+            }
+
+            auto content = stash<>::map(file);
+
+            if (!content.has_value())
+            {
+                return false;
+            }
+
+            sources.emplace_back(name, std::move(content.value()), encoding);
+        }
+
+        if (ec)
+        {
+            return false;
+        }
+
+        std::ranges::sort(sources, {}, &source::name);
+
+        const auto count = sources.size();
+
+        std::string strings;
+        std::vector<format::entry> entries;
+
+        const auto strings_offset = sizeof(format::header) + (count * sizeof(format::entry));
+
+        auto append = [&](std::string_view value)
+        {
+            const auto rtn = strings_offset + strings.size();
+            strings.append(value);
+
+            return rtn;
+        };
+
+        auto align = [](std::uint64_t offset)
+        {
+            return (offset + format::alignment - 1) & ~(format::alignment - 1);
+        };
+
+        for (const auto &[name, content, encoding] : sources)
+        {
+            const auto mime = scheme::utils::mime(name);
+            const auto etag = scheme::etag(content);
+
+            entries.emplace_back(format::entry{
+                .name      = append(name),
+                .mime      = append(mime),
+                .etag      = append(etag),
+                .offset    = 0,
+                .size      = content.size(),
+                .name_size = static_cast<std::uint32_t>(name.size()),
+                .mime_size = static_cast<std::uint16_t>(mime.size()),
+                .etag_size = static_cast<std::uint8_t>(etag.size()),
+                .encoding  = encoding,
+            });
+        }
+
+        auto offset = align(strings_offset + strings.size());
+
+        for (auto &entry : entries)
+        {
+            entry.offset = offset;
+            offset       = align(offset + entry.size);
+        }
+
+        const auto header = format::header{
+            .magic   = format::magic,
+            .version = format::version,
+            .count   = static_cast<std::uint32_t>(count),
+            .entries = sizeof(format::header),
+        };
+
+        std::ofstream stream{output, std::ios::binary | std::ios::trunc};
+
+        auto write = [&stream](const void *data, std::size_t size)
+        {
+            stream.write(static_cast<const char *>(data), static_cast<std::streamsize>(size));
+        };
+
+        auto pad = [&](std::uint64_t until)
+        {
+            static constexpr std::array<char, format::alignment> zeros{};
+            write(zeros.data(), until - static_cast<std::uint64_t>(stream.tellp()));
+        };
+
+        write(&header, sizeof(header));
+        write(entries.data(), entries.size() * sizeof(format::entry));
+        write(strings.data(), strings.size());
+
+        for (auto i = 0uz; count > i; ++i)
+        {
+            pad(entries[i].offset);
+            write(sources[i].content.data(), sources[i].content.size());
+        }
+
+        return stream.good();
+    }
+} // namespace saucer
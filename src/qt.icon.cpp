@@ -69,12 +69,15 @@ namespace saucer
             return stash<>::empty();
         }
 
-        QByteArray bytes;
+        auto bytes = std::make_shared<QByteArray>();
 
-        QBuffer buffer{&bytes};
+        QBuffer buffer{bytes.get()};
         pixmap->save(&buffer, "PNG");
 
-        return stash<>::from({bytes.begin(), bytes.end()});
+        const auto *raw = reinterpret_cast<const std::uint8_t *>(bytes->constData());
+        const auto size  = static_cast<std::size_t>(bytes->size());
+
+        return stash<>::share(std::move(bytes), {raw, raw + size});
     }
 
     void icon::save(const fs::path &path) const
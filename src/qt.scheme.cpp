@@ -1,14 +1,29 @@
 #include "qt.scheme.impl.hpp"
 
 #include <ranges>
+#include <cstring>
+#include <algorithm>
 
 #include <QMap>
-#include <QBuffer>
-#include <QIODevice>
 
 namespace saucer::scheme
 {
-    request::request(impl data) : m_impl(std::make_unique<impl>(std::move(data))) {}
+    request::request(impl data) : m_impl(std::make_unique<impl>(std::move(data)))
+    {
+        // The job may only be accessed from the main thread, which is why everything is captured up-front. This also spares
+        // us from locking the job on every access.
+
+        const auto request = m_impl->request->write();
+
+        if (!request.value())
+        {
+            return;
+        }
+
+        m_impl->url     = request.value()->requestUrl().toString().toStdString();
+        m_impl->method  = request.value()->requestMethod().toStdString();
+        m_impl->headers = request.value()->requestHeaders();
+    }
 
     request::request(const request &other) : m_impl(std::make_unique<impl>(*other.m_impl)) {}
 
@@ -18,62 +33,217 @@ namespace saucer::scheme
 
     std::string request::url() const
     {
-        const auto request = m_impl->request->write();
+        return m_impl->url;
+    }
 
-        if (!request.value())
+    std::string request::method() const
+    {
+        return m_impl->method;
+    }
+
+    std::string_view request::url_view() const
+    {
+        return m_impl->url;
+    }
+
+    std::string_view request::method_view() const
+    {
+        return m_impl->method;
+    }
+
+    stash<> request::content() const
+    {
+        const auto *data = reinterpret_cast<const std::uint8_t *>(m_impl->body.data());
+        return stash<>::view({data, data + m_impl->body.size()});
+    }
+
+    std::map<std::string, std::string> request::headers() const
+    {
+        std::map<std::string, std::string> rtn;
+
+        for (auto it = m_impl->headers.cbegin(); it != m_impl->headers.cend(); ++it)
         {
-            return {};
+            rtn.emplace(it.key().toStdString(), it.value().toStdString());
         }
 
-        return request.value()->requestUrl().toString().toStdString();
+        return rtn;
     }
 
-    std::string request::method() const
+    std::optional<std::string_view> request::header(std::string_view name) const
     {
-        const auto request = m_impl->request->write();
+        const auto key = QByteArray::fromRawData(name.data(), static_cast<qsizetype>(name.size()));
 
-        if (!request.value())
+        for (auto it = m_impl->headers.cbegin(); it != m_impl->headers.cend(); ++it)
         {
-            return {};
+            if (it.key().compare(key, Qt::CaseInsensitive) != 0)
+            {
+                continue;
+            }
+
+            return std::string_view{it.value().constData(), static_cast<std::size_t>(it.value().size())};
         }
 
-        return request.value()->requestMethod().toStdString();
+        return std::nullopt;
     }
 
-    stash<> request::content() const
+    std::optional<stash<>> request::read(std::size_t size) const
     {
-        const auto *data = reinterpret_cast<const std::uint8_t *>(m_impl->body.data());
-        return stash<>::view({data, data + m_impl->body.size()});
+        const auto total = static_cast<std::size_t>(m_impl->body.size());
+
+        if (m_impl->offset >= total)
+        {
+            return std::nullopt;
+        }
+
+        const auto count = std::min(size, total - m_impl->offset);
+        auto owner       = std::make_shared<QByteArray>(m_impl->body);
+
+        const auto *data = reinterpret_cast<const std::uint8_t *>(owner->constData()) + m_impl->offset;
+        m_impl->offset += count;
+
+        return stash<>::share(std::move(owner), {data, data + count});
     }
 
-    std::map<std::string, std::string> request::headers() const
+    stash_device::stash_device(stash<> data) : m_data(std::move(data))
     {
-        const auto request = m_impl->request->write();
+        open(QIODevice::ReadOnly | QIODevice::Unbuffered);
+    }
 
-        if (!request.value())
+    bool stash_device::isSequential() const
+    {
+        return false;
+    }
+
+    qint64 stash_device::size() const
+    {
+        return static_cast<qint64>(m_data.size());
+    }
+
+    qint64 stash_device::readData(char *data, qint64 max)
+    {
+        const auto offset = pos();
+        const auto count  = std::min(max, size() - offset);
+
+        if (count <= 0)
+        {
+            return 0;
+        }
+
+        std::memcpy(data, m_data.data() + offset, static_cast<std::size_t>(count));
+
+        return count;
+    }
+
+    qint64 stash_device::writeData(const char *, qint64)
+    {
+        return -1;
+    }
+
+    stream_device::stream_device(scheme::stream stream) : m_stream(std::move(stream))
+    {
+        open(QIODevice::ReadOnly | QIODevice::Unbuffered);
+
+        m_stream.on_ready(
+            [this]
+            {
+                QMetaObject::invokeMethod(
+                    this,
+                    [this]
+                    {
+                        fill();
+                        emit readyRead();
+
+                        if (m_stream.finished())
+                        {
+                            emit readChannelFinished();
+                        }
+                    },
+                    Qt::QueuedConnection);
+            });
+    }
+
+    stream_device::~stream_device()
+    {
+        m_stream.on_ready(nullptr);
+        m_stream.cancel();
+    }
+
+    void stream_device::fill()
+    {
+        while (auto chunk = m_stream.poll())
         {
-            return {};
+            m_chunks.emplace_back(std::move(chunk.value()));
         }
+    }
+
+    bool stream_device::atEnd() const
+    {
+        return m_chunks.empty() && m_stream.finished();
+    }
 
-        const auto headers = request.value()->requestHeaders();
+    bool stream_device::isSequential() const
+    {
+        return true;
+    }
 
-        auto transform = [&headers](auto &item)
+    qint64 stream_device::bytesAvailable() const
+    {
+        auto rtn = QIODevice::bytesAvailable() - static_cast<qint64>(m_offset);
+
+        for (const auto &chunk : m_chunks)
         {
-            return std::make_pair(item.toStdString(), headers[item].toStdString());
-        };
+            rtn += static_cast<qint64>(chunk.size());
+        }
+
+        return rtn;
+    }
+
+    qint64 stream_device::readData(char *data, qint64 max)
+    {
+        fill();
+
+        auto rtn = qint64{0};
+
+        while (rtn < max && !m_chunks.empty())
+        {
+            const auto &front = m_chunks.front();
+            const auto count  = std::min(max - rtn, static_cast<qint64>(front.size() - m_offset));
+
+            std::memcpy(data + rtn, front.data() + m_offset, static_cast<std::size_t>(count));
+
+            rtn += count;
+            m_offset += static_cast<std::size_t>(count);
+
+            if (m_offset < front.size())
+            {
+                continue;
+            }
+
+            m_chunks.pop_front();
+            m_offset = 0;
+        }
+
+        if (rtn == 0 && m_stream.finished())
+        {
+            return -1;
+        }
+
+        return rtn;
+    }
 
-        return headers                            //
-               | std::views::transform(transform) //
-               | std::ranges::to<std::map<std::string, std::string>>();
+    qint64 stream_device::writeData(const char *, qint64)
+    {
+        return -1;
     }
 
     handler::handler(application *app, launch policy, scheme::resolver resolver)
-        : app(app), policy(policy), resolver(std::move(resolver))
+        : app(app), policy(policy), resolver(std::move(resolver)), completions(app)
     {
     }
 
     handler::handler(handler &&other) noexcept
-        : app(std::exchange(other.app, nullptr)), policy(other.policy), resolver(std::move(other.resolver))
+        : app(std::exchange(other.app, nullptr)), policy(other.policy), resolver(std::move(other.resolver)),
+          completions(std::move(other.completions))
     {
     }
 
@@ -90,13 +260,29 @@ namespace saucer::scheme
 #ifdef SAUCER_QT6
         auto *const body = raw->requestBody();
 
-        if (raw->requestBody())
+        static constexpr auto chunk = qint64{64} * 1024;
+
+        if (body)
         {
-            content = body->readAll();
+            content.reserve(body->size());
+        }
+
+        while (body && !body->atEnd())
+        {
+            const auto offset = content.size();
+            content.resize(offset + std::max(body->bytesAvailable(), chunk));
+
+            const auto read = body->read(content.data() + offset, content.size() - offset);
+            content.resize(offset + std::max(read, qint64{0}));
+
+            if (read <= 0)
+            {
+                break;
+            }
         }
 #endif
 
-        auto resolve = [request](const scheme::response &response)
+        auto resolve = [request](scheme::response response)
         {
             const auto req = request->write();
 
@@ -117,15 +303,19 @@ namespace saucer::scheme
             req.value()->setAdditionalResponseHeaders(converted);
 #endif
 
-            const auto data = response.data;
-            auto *buffer    = new QBuffer{};
+            QIODevice *device{};
 
-            buffer->open(QIODevice::WriteOnly);
-            buffer->write(reinterpret_cast<const char *>(data.data()), static_cast<std::int64_t>(data.size()));
-            buffer->close();
+            if (response.stream.has_value())
+            {
+                device = new stream_device{std::move(response.stream.value())};
+            }
+            else
+            {
+                device = new stash_device{std::move(response.data)};
+            }
 
-            connect(req.value(), &QObject::destroyed, buffer, &QObject::deleteLater);
-            req.value()->reply(QString::fromStdString(response.mime).toUtf8(), buffer);
+            connect(req.value(), &QObject::destroyed, device, &QObject::deleteLater);
+            req.value()->reply(QString::fromStdString(response.mime).toUtf8(), device);
         };
 
         auto reject = [request](const scheme::error &error)
@@ -141,7 +331,9 @@ namespace saucer::scheme
             req.value()->fail(static_cast<QWebEngineUrlRequestJob::Error>(offset));
         };
 
-        auto executor = scheme::executor{std::move(resolve), std::move(reject)};
+        // Handlers may finish on any thread, completions are funneled back to the main thread and handled in batches.
+
+        auto executor = scheme::executor{completions.wrap(std::move(resolve)), completions.wrap(std::move(reject))};
         auto req      = scheme::request{{request, std::move(content)}};
 
         connect(raw, &QObject::destroyed, [request]() { request->assign(nullptr); });
@@ -1,12 +1,17 @@
 #include "qt.webview.impl.hpp"
 
+#include "scheduler.hpp"
 #include "instantiate.hpp"
+#include "script_batch.hpp"
 #include "qt.icon.impl.hpp"
 #include "qt.window.impl.hpp"
 
 #include <fmt/core.h>
 #include <fmt/xchar.h>
 
+#include <utility>
+#include <algorithm>
+
 #include <QWebEngineScriptCollection>
 #include <QWebEngineProfile>
 #include <QWebEngineSettings>
@@ -19,6 +24,11 @@ namespace saucer
         static std::once_flag flag;
         std::call_once(flag, [] { register_scheme("saucer"); });
 
+        if (prefs.batch_scripts)
+        {
+            m_batch = std::make_shared<utils::script_batch>(m_parent.get(), [this](const auto &code) { m_impl->run(code); });
+        }
+
         auto flags = prefs.browser_flags;
 
         if (prefs.hardware_acceleration)
@@ -68,7 +78,7 @@ namespace saucer
                                   [this]
                                   {
                                       m_impl->dom_loaded = false;
-                                      m_events.at<web_event::load>().fire(state::started);
+                                      on_load(state::started);
                                   });
 
         window::m_impl->on_closed = [this]
@@ -298,14 +308,43 @@ namespace saucer
             return m_parent->dispatch([this] { return clear_scripts(); });
         }
 
+        auto scripts = std::exchange(m_impl->scripts, {});
+        std::erase_if(scripts, [](const auto &script) { return !script.permanent; });
+
         m_impl->web_view->page()->scripts().clear();
 
-        for (const auto &script : m_impl->permanent_scripts)
+        for (const auto &script : scripts)
         {
             inject(script);
         }
     }
 
+    void webview::uninject(const script &script)
+    {
+        if (!m_parent->thread_safe())
+        {
+            return m_parent->dispatch([this, script] { uninject(script); });
+        }
+
+        // All scripts of the same load-time are joined into a single one, which is why they are re-injected without the
+        // removed script.
+
+        auto scripts  = std::exchange(m_impl->scripts, {});
+        const auto it = std::ranges::find(scripts, script);
+
+        if (it != scripts.end())
+        {
+            scripts.erase(it);
+        }
+
+        m_impl->web_view->page()->scripts().clear();
+
+        for (const auto &remaining : scripts)
+        {
+            inject(remaining);
+        }
+    }
+
     void webview::execute(const std::string &code)
     {
         if (!m_parent->thread_safe())
@@ -319,7 +358,12 @@ namespace saucer
             return;
         }
 
-        m_impl->web_view->page()->runJavaScript(QString::fromStdString(code));
+        if (!m_batch)
+        {
+            return m_impl->run(code);
+        }
+
+        m_batch->push(code);
     }
 
     void webview::handle_scheme(const std::string &name, scheme::resolver &&resolver, launch policy)
@@ -348,6 +392,11 @@ namespace saucer
             return m_parent->dispatch([this, name] { return remove_scheme(name); });
         }
 
+        if (m_scheduler)
+        {
+            m_scheduler->remove(name);
+        }
+
         const auto it = m_impl->schemes.find(name);
 
         if (it == m_impl->schemes.end())
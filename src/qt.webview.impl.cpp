@@ -17,6 +17,11 @@
 
 namespace saucer
 {
+    void webview::impl::run(const std::string &code) const
+    {
+        web_view->page()->runJavaScript(QString::fromStdString(code));
+    }
+
     std::string webview::impl::inject_script()
     {
         static constexpr auto internal = R"js(
@@ -29,6 +34,20 @@ namespace saucer
             message: async (message) =>
             {
                 (await window.saucer.internal.channel).on_message(message);
+            },
+            binary: async (frame) =>
+            {
+                // The web-channel only transports JSON, we thus hand over the frame as latin1 string, which maps every
+                // character to exactly one byte and is thus cheap to convert back on the native side.
+
+                let data = "";
+
+                for (let i = 0; frame.length > i; i += 0x8000)
+                {
+                    data += String.fromCharCode.apply(null, frame.subarray(i, i + 0x8000));
+                }
+
+                (await window.saucer.internal.channel).on_binary(data);
             }
         )js";
 
@@ -58,8 +77,10 @@ namespace saucer
 
     void webview::impl::web_class::on_message(const QString &raw)
     {
-        auto message = raw.toStdString();
-        auto &self   = *m_parent;
+        const auto utf8 = raw.toUtf8();
+        auto &self      = *m_parent;
+
+        const std::string_view message{utf8.constData(), static_cast<std::size_t>(utf8.size())};
 
         if (message == "dom_loaded")
         {
@@ -71,7 +92,7 @@ namespace saucer
             }
 
             self.m_impl->pending.clear();
-            self.m_events.at<web_event::dom_ready>().fire();
+            self.on_dom_ready();
 
             return;
         }
@@ -79,6 +100,18 @@ namespace saucer
         self.on_message(message);
     }
 
+    void webview::impl::web_class::on_binary(const QString &raw)
+    {
+        // The web-channel only transports strings, the conversion from latin1 is thus the one copy that is needed to
+        // get to the bytes. The resulting array is then shared with the buffers of the call.
+
+        auto data          = std::make_shared<const QByteArray>(raw.toLatin1());
+        const auto *buffer = reinterpret_cast<const std::uint8_t *>(data->constData());
+        const auto size    = static_cast<std::size_t>(data->size());
+
+        m_parent->on_binary(stash<>::share(std::move(data), {buffer, size}));
+    }
+
     template <>
     void webview::impl::setup<web_event::dom_ready>(webview *)
     {
@@ -196,7 +229,7 @@ namespace saucer
 
         auto handler = [self](auto...)
         {
-            self->m_events.at<web_event::load>().fire(state::finished);
+            self->on_load(state::finished);
         };
 
         const auto id = web_view->connect(web_view.get(), &QWebEngineView::loadFinished, handler);
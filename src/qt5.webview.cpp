@@ -1,7 +1,5 @@
 #include "qt.webview.impl.hpp"
 
-#include <algorithm>
-
 #include <QWebEngineScript>
 #include <QWebEngineScriptCollection>
 
@@ -16,10 +14,7 @@ namespace saucer
             return m_parent->dispatch([this, script] { inject(script); });
         }
 
-        if (script.permanent && !std::ranges::contains(m_impl->permanent_scripts, script))
-        {
-            m_impl->permanent_scripts.emplace_back(script);
-        }
+        m_impl->scripts.emplace_back(script);
 
         QWebEngineScript web_script;
         bool found = false;
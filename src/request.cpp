@@ -56,4 +56,175 @@ namespace saucer
 
         return fmt::format("{}", fmt::join(stubs, ",\n\t\t"));
     }
+
+    std::string_view request::tag_of(std::string_view data)
+    {
+        // All messages emitted by our scripts carry their "saucer:*" tag as the first key, which allows us to
+        // route them without parsing the whole payload.
+
+        static constexpr std::string_view whitespace = " \t\r\n";
+        static constexpr std::string_view prefix     = "saucer:";
+
+        auto start = data.find_first_not_of(whitespace);
+
+        if (start == std::string_view::npos || data[start] != '{')
+        {
+            return {};
+        }
+
+        start = data.find_first_not_of(whitespace, start + 1);
+
+        if (start == std::string_view::npos || data[start] != '"')
+        {
+            return {};
+        }
+
+        const auto end = data.find('"', start + 1);
+
+        if (end == std::string_view::npos)
+        {
+            return {};
+        }
+
+        const auto rtn = data.substr(start + 1, end - start - 1);
+
+        if (!rtn.starts_with(prefix))
+        {
+            return {};
+        }
+
+        return rtn;
+    }
+
+    std::optional<std::vector<std::string_view>> request::split(std::string_view data)
+    {
+        // Calls issued within the same microtask are sent as one array. We only locate the boundaries of the
+        // top-level elements here, parsing them is left to the serializer.
+
+        static constexpr std::string_view whitespace = " \t\r\n";
+
+        const auto start = data.find_first_not_of(whitespace);
+
+        if (start == std::string_view::npos || data[start] != '[')
+        {
+            return std::nullopt;
+        }
+
+        std::vector<std::string_view> rtn;
+
+        auto depth   = 0uz;
+        auto begin   = start + 1;
+        auto escaped = false;
+        auto quoted  = false;
+
+        auto emplace = [&](std::size_t end)
+        {
+            auto element = data.substr(begin, end - begin);
+
+            element.remove_prefix(std::min(element.find_first_not_of(whitespace), element.size()));
+            element.remove_suffix(element.size() - std::min(element.find_last_not_of(whitespace) + 1, element.size()));
+
+            if (element.empty())
+            {
+                return;
+            }
+
+            rtn.emplace_back(element);
+        };
+
+        for (auto i = begin; data.size() > i; i++)
+        {
+            const auto current = data[i];
+
+            if (quoted)
+            {
+                quoted  = escaped || current != '"';
+                escaped = !escaped && current == '\\';
+                continue;
+            }
+
+            switch (current)
+            {
+            case '"':
+                quoted = true;
+                break;
+            case '{':
+            case '[':
+                depth++;
+                break;
+            case '}':
+            case ']':
+                if (depth > 0)
+                {
+                    depth--;
+                    break;
+                }
+                emplace(i);
+                return rtn;
+            case ',':
+                if (depth > 0)
+                {
+                    break;
+                }
+                emplace(i);
+                begin = i + 1;
+                break;
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    std::optional<request::frame> request::unpack(std::span<const std::uint8_t> data)
+    {
+        // Binary messages consist of a serialized header followed by the buffers it refers to, each of them is prefixed
+        // by its size (encoded as little-endian 32-bit integer).
+
+        auto next = [&data]() -> std::optional<std::span<const std::uint8_t>>
+        {
+            if (data.size() < 4)
+            {
+                return std::nullopt;
+            }
+
+            const auto size = static_cast<std::uint32_t>(data[0] | (data[1] << 8) | (data[2] << 16)) |
+                              (static_cast<std::uint32_t>(data[3]) << 24);
+
+            if (data.size() - 4 < size)
+            {
+                return std::nullopt;
+            }
+
+            auto rtn = data.subspan(4, size);
+            data     = data.subspan(4 + size);
+
+            return rtn;
+        };
+
+        const auto header = next();
+
+        if (!header)
+        {
+            return std::nullopt;
+        }
+
+        frame rtn{
+            .header  = {reinterpret_cast<const char *>(header->data()), header->size()},
+            .buffers = {},
+        };
+
+        while (!data.empty())
+        {
+            const auto buffer = next();
+
+            if (!buffer)
+            {
+                return std::nullopt;
+            }
+
+            rtn.buffers.emplace_back(buffer.value());
+        }
+
+        return rtn;
+    }
 } // namespace saucer
@@ -1,6 +1,6 @@
 #include "serializers/rflpp/rflpp.hpp"
 
-#include <expected>
+#include "request.hpp"
 
 namespace rfl
 {
@@ -13,13 +13,13 @@ namespace rfl
         {
             rfl::Rename<"saucer:call", bool> tag;
             std::uint64_t id;
-            std::string name;
+            saucer::function_id function;
             rfl::Generic params;
         };
 
         static function_data to(const ReflType &v) noexcept
         {
-            return {{v.id, v.name}, v.params};
+            return {{v.id, v.function, {}}, v.params};
         }
     };
 
@@ -55,28 +55,30 @@ namespace saucer::serializers::rflpp
     }
 
     template <typename T>
-    std::optional<T> parse_as(const std::string &buffer)
+    serializer::parse_result parse_as(std::string_view buffer)
     {
         auto result = rfl::json::read<T>(buffer);
 
         if (!result)
         {
-            return std::nullopt;
+            return std::monostate{};
         }
 
-        return result.value();
+        return std::make_unique<T>(std::move(result.value()));
     }
 
-    serializer::parse_result serializer::parse(const std::string &data) const
+    serializer::parse_result serializer::parse(std::string_view data) const
     {
-        if (auto res = parse_as<function_data>(data); res.has_value())
+        const auto tag = request::tag_of(data);
+
+        if (tag == "saucer:call")
         {
-            return std::make_unique<function_data>(res.value());
+            return parse_as<function_data>(data);
         }
 
-        if (auto res = parse_as<result_data>(data); res.has_value())
+        if (tag == "saucer:resolve")
         {
-            return std::make_unique<result_data>(res.value());
+            return parse_as<result_data>(data);
         }
 
         return std::monostate{};
@@ -0,0 +1,302 @@
+#include "scheduler.hpp"
+
+#include <deque>
+#include <atomic>
+#include <chrono>
+#include <ranges>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <functional>
+
+#include <unordered_map>
+
+#include <lockpp/lock.hpp>
+
+namespace saucer::utils
+{
+    struct scheduler::state : std::enable_shared_from_this<state>
+    {
+        using clock = std::chrono::steady_clock;
+
+      public:
+        struct job
+        {
+            scheme::request request;
+            scheme::executor executor;
+
+          public:
+            clock::time_point queued;
+        };
+
+        struct queue
+        {
+            scheme::limits limits;
+            scheme::resolver resolver;
+
+          public:
+            std::deque<job> pending;
+            scheme_stats stats{};
+
+          public:
+            bool removed{false};
+        };
+
+        struct task
+        {
+            std::shared_ptr<queue> origin;
+            scheme::resolver resolver;
+            job work;
+        };
+
+        struct ticket
+        {
+            std::shared_ptr<state> self;
+            std::shared_ptr<queue> origin;
+
+          public:
+            std::atomic_flag released;
+
+          public:
+            ~ticket();
+
+          public:
+            void release();
+        };
+
+        struct registry
+        {
+            std::size_t active{0};
+            std::unordered_map<std::string, std::shared_ptr<queue>> queues;
+        };
+
+      public:
+        application *app;
+        std::size_t capacity;
+
+      public:
+        lockpp::lock<registry> ledger;
+
+      public:
+        [[nodiscard]] std::vector<task> admit(registry &);
+
+      public:
+        void run(std::vector<task>);
+        void finish(const std::shared_ptr<queue> &);
+        void enqueue(const std::shared_ptr<queue> &, scheme::request, scheme::executor);
+    };
+
+    scheduler::state::ticket::~ticket()
+    {
+        release();
+    }
+
+    void scheduler::state::ticket::release()
+    {
+        if (released.test_and_set())
+        {
+            return;
+        }
+
+        self->finish(origin);
+    }
+
+    std::vector<scheduler::state::task> scheduler::state::admit(registry &ledger)
+    {
+        auto eligible = [](const auto &item)
+        {
+            const auto &[name, queue] = item;
+            const auto limit          = queue->limits.concurrency;
+
+            return !queue->pending.empty() && (limit == 0 || queue->stats.active < limit);
+        };
+
+        // Among the queues that may start another job, the one with the highest priority wins. Queues of equal priority
+        // take turns by the age of their oldest job, so that one busy scheme cannot shut out another.
+
+        auto rank = [](const auto &item)
+        {
+            const auto &[name, queue] = item;
+            return std::make_pair(queue->limits.priority, queue->pending.front().queued);
+        };
+
+        std::vector<task> rtn;
+
+        while (ledger.active < capacity)
+        {
+            auto candidates = ledger.queues | std::views::filter(eligible);
+            const auto it   = std::ranges::min_element(candidates, {}, rank);
+
+            if (it == candidates.end())
+            {
+                break;
+            }
+
+            const auto &queue = (*it).second;
+            auto work         = std::move(queue->pending.front());
+
+            queue->pending.pop_front();
+
+            const auto waited = std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - work.queued);
+            auto &stats       = queue->stats;
+
+            stats.queued  = queue->pending.size();
+            stats.waited += waited;
+            stats.longest = std::max(stats.longest, waited);
+
+            ++stats.active;
+            ++ledger.active;
+
+            rtn.emplace_back(queue, queue->resolver, std::move(work));
+        }
+
+        return rtn;
+    }
+
+    void scheduler::state::run(std::vector<task> tasks)
+    {
+        for (auto &item : tasks)
+        {
+            // A job occupies its slot until it was answered, which may well happen after the resolver returned. Should
+            // the executor be dropped without ever being invoked, the slot is released along with the last copy of it.
+
+            auto slot = std::make_shared<ticket>(shared_from_this(), item.origin);
+            auto &[resolve, reject] = item.work.executor;
+
+            item.work.executor = {
+                .resolve = [slot, resolve = std::move(resolve)](scheme::response response)
+                {
+                    std::invoke(resolve, std::move(response));
+                    slot->release();
+                },
+                .reject = [slot, reject = std::move(reject)](scheme::error error)
+                {
+                    std::invoke(reject, error);
+                    slot->release();
+                },
+            };
+
+            app->pool().emplace(
+                [task = std::move(item)]() mutable
+                { std::invoke(task.resolver, std::move(task.work.request), std::move(task.work.executor)); });
+        }
+    }
+
+    void scheduler::state::finish(const std::shared_ptr<queue> &origin)
+    {
+        std::vector<task> ready;
+
+        {
+            auto locked = ledger.write();
+
+            --origin->stats.active;
+            ++origin->stats.completed;
+            --locked->active;
+
+            ready = admit(locked.value());
+        }
+
+        run(std::move(ready));
+    }
+
+    void scheduler::state::enqueue(const std::shared_ptr<queue> &origin, scheme::request request, scheme::executor executor)
+    {
+        std::vector<task> ready;
+        bool removed{};
+
+        {
+            auto locked = ledger.write();
+            auto &stats = origin->stats;
+
+            // A request might still arrive through the resolver of a scheme that was removed in the meantime, it would
+            // never be admitted.
+
+            removed = origin->removed;
+
+            if (!removed)
+            {
+                origin->pending.emplace_back(std::move(request), std::move(executor), clock::now());
+
+                stats.queued = origin->pending.size();
+                stats.peak   = std::max(stats.peak, stats.queued);
+
+                ready = admit(locked.value());
+            }
+        }
+
+        if (removed)
+        {
+            return std::invoke(executor.reject, scheme::error::aborted);
+        }
+
+        run(std::move(ready));
+    }
+
+    scheduler::scheduler(application *app) : m_state(std::make_shared<state>())
+    {
+        // The thread-pool is shared with everything else that runs in the background (e.g. functions exposed with
+        // `launch::async`), the capacity is thus merely an upper bound on how many requests may be in-flight at once.
+
+        m_state->app      = app;
+        m_state->capacity = std::max<std::size_t>(app->threads(), 1);
+    }
+
+    std::optional<scheme_stats> scheduler::stats(const std::string &name) const
+    {
+        auto locked = m_state->ledger.read();
+        auto it     = locked->queues.find(name);
+
+        if (it == locked->queues.end())
+        {
+            return std::nullopt;
+        }
+
+        return it->second->stats;
+    }
+
+    void scheduler::remove(const std::string &name)
+    {
+        std::deque<state::job> dropped;
+
+        {
+            auto locked = m_state->ledger.write();
+            auto it     = locked->queues.find(name);
+
+            if (it == locked->queues.end())
+            {
+                return;
+            }
+
+            dropped             = std::move(it->second->pending);
+            it->second->removed = true;
+
+            locked->queues.erase(it);
+        }
+
+        // Jobs that are already running finish on their own, the ones that did not start yet are turned away.
+
+        for (auto &job : dropped)
+        {
+            std::invoke(job.executor.reject, scheme::error::aborted);
+        }
+    }
+
+    scheme::resolver scheduler::wrap(const std::string &name, scheme::resolver resolver, scheme::limits limits)
+    {
+        auto locked = m_state->ledger.write();
+        auto &queue = locked->queues[name];
+
+        // Just like the backends, which ignore a scheme that is already handled, the first registration is kept until
+        // the scheme is removed. Jobs are thus never handed to a resolver they were not queued for.
+
+        if (!queue)
+        {
+            queue = std::make_shared<state::queue>(limits, std::move(resolver));
+        }
+
+        return [state = m_state, queue](scheme::request request, scheme::executor executor)
+        {
+            state->enqueue(queue, std::move(request), std::move(executor));
+        };
+    }
+} // namespace saucer::utils
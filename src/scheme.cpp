@@ -0,0 +1,1260 @@
+#include "scheme.utils.hpp"
+
+#include <array>
+#include <deque>
+#include <mutex>
+#include <cctype>
+#include <random>
+#include <ranges>
+#include <thread>
+#include <vector>
+#include <fstream>
+#include <utility>
+#include <charconv>
+#include <algorithm>
+#include <unordered_map>
+#include <condition_variable>
+
+#include <string_view>
+
+#include <fmt/core.h>
+#include <lockpp/lock.hpp>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#include <stdlib.h>
+#endif
+
+namespace saucer::scheme
+{
+    namespace fs = std::filesystem;
+
+    static constexpr auto mime_types = std::to_array<std::pair<std::string_view, std::string_view>>({
+        {".html", "text/html"},
+        {".htm", "text/html"},
+        {".css", "text/css"},
+        {".js", "application/javascript"},
+        {".mjs", "application/javascript"},
+        {".json", "application/json"},
+        {".map", "application/json"},
+        {".wasm", "application/wasm"},
+        {".txt", "text/plain"},
+        {".xml", "application/xml"},
+        {".svg", "image/svg+xml"},
+        {".png", "image/png"},
+        {".jpg", "image/jpeg"},
+        {".jpeg", "image/jpeg"},
+        {".gif", "image/gif"},
+        {".webp", "image/webp"},
+        {".avif", "image/avif"},
+        {".ico", "image/x-icon"},
+        {".bmp", "image/bmp"},
+        {".woff", "font/woff"},
+        {".woff2", "font/woff2"},
+        {".ttf", "font/ttf"},
+        {".otf", "font/otf"},
+        {".pdf", "application/pdf"},
+        {".mp3", "audio/mpeg"},
+        {".wav", "audio/wav"},
+        {".ogg", "audio/ogg"},
+        {".mp4", "video/mp4"},
+        {".webm", "video/webm"},
+    });
+
+    std::string utils::mime(const fs::path &file)
+    {
+        auto extension = file.extension().string();
+        std::ranges::transform(extension, extension.begin(), [](unsigned char c) { return std::tolower(c); });
+
+        const auto it = std::ranges::find(mime_types, extension, [](const auto &entry) { return entry.first; });
+
+        if (it == mime_types.end())
+        {
+            return "application/octet-stream";
+        }
+
+        return std::string{it->second};
+    }
+
+    static std::optional<std::string> decode(std::string_view encoded)
+    {
+        std::string rtn;
+        rtn.reserve(encoded.size());
+
+        auto hex = [](char c) -> int
+        {
+            if (c >= '0' && c <= '9')
+            {
+                return c - '0';
+            }
+
+            const auto lower = std::tolower(static_cast<unsigned char>(c));
+
+            if (lower >= 'a' && lower <= 'f')
+            {
+                return lower - 'a' + 10;
+            }
+
+            return -1;
+        };
+
+        for (auto i = 0uz; encoded.size() > i; ++i)
+        {
+            if (encoded[i] != '%')
+            {
+                rtn.push_back(encoded[i]);
+                continue;
+            }
+
+            if (i + 2 >= encoded.size())
+            {
+                return std::nullopt;
+            }
+
+            const auto high = hex(encoded[i + 1]);
+            const auto low  = hex(encoded[i + 2]);
+
+            if (high < 0 || low < 0)
+            {
+                return std::nullopt;
+            }
+
+            rtn.push_back(static_cast<char>((high << 4) | low));
+            i += 2;
+        }
+
+        if (rtn.contains('\0'))
+        {
+            return std::nullopt;
+        }
+
+        return rtn;
+    }
+
+    struct stream::impl
+    {
+        std::size_t capacity;
+
+      public:
+        std::mutex mutex;
+        std::condition_variable cv;
+
+      public:
+        std::size_t buffered{0};
+        std::deque<stash<>> chunks;
+
+      public:
+        bool closed{false};
+        bool cancelled{false};
+
+      public:
+        std::function<void()> ready;
+        std::condition_variable settled;
+
+      public:
+        std::uint64_t generation{0};
+        std::optional<std::thread::id> notifier;
+
+      public:
+        void notify();
+        std::optional<stash<>> take();
+    };
+
+    void stream::impl::notify()
+    {
+        std::unique_lock lock{mutex};
+
+        ++generation;
+
+        // Only one thread invokes the callback at a time and it does so without holding the lock, so that the callback
+        // may freely write to (or close) the stream. Notifications that arrive in the meantime, including the ones
+        // caused by the callback itself, are picked up by the thread that is already notifying.
+
+        if (notifier)
+        {
+            return;
+        }
+
+        notifier.emplace(std::this_thread::get_id());
+
+        std::function<void()> expired;
+
+        while (ready)
+        {
+            const auto seen = generation;
+            const auto last = closed;
+            auto callback   = ready;
+
+            lock.unlock();
+
+            std::invoke(callback);
+            callback = nullptr;
+
+            lock.lock();
+
+            if (last)
+            {
+                expired = std::exchange(ready, nullptr);
+                break;
+            }
+
+            if (generation == seen)
+            {
+                break;
+            }
+        }
+
+        notifier.reset();
+        lock.unlock();
+
+        settled.notify_all();
+    }
+
+    std::optional<stash<>> stream::impl::take()
+    {
+        if (chunks.empty())
+        {
+            return std::nullopt;
+        }
+
+        auto rtn = std::move(chunks.front());
+
+        chunks.pop_front();
+        buffered -= rtn.size();
+
+        cv.notify_all();
+
+        return rtn;
+    }
+
+    stream::stream(std::size_t capacity) : m_impl(std::make_shared<impl>())
+    {
+        m_impl->capacity = capacity;
+    }
+
+    bool stream::write(stash<> chunk)
+    {
+        {
+            std::unique_lock lock{m_impl->mutex};
+            m_impl->cv.wait(lock, [this] { return m_impl->cancelled || m_impl->buffered < m_impl->capacity; });
+
+            if (m_impl->cancelled || m_impl->closed)
+            {
+                return false;
+            }
+
+            m_impl->buffered += chunk.size();
+            m_impl->chunks.emplace_back(std::move(chunk));
+        }
+
+        m_impl->cv.notify_all();
+        m_impl->notify();
+
+        return true;
+    }
+
+    void stream::close()
+    {
+        {
+            const std::lock_guard guard{m_impl->mutex};
+            m_impl->closed = true;
+        }
+
+        m_impl->cv.notify_all();
+        m_impl->notify();
+    }
+
+    bool stream::finished() const
+    {
+        const std::lock_guard guard{m_impl->mutex};
+        return m_impl->cancelled || (m_impl->closed && m_impl->chunks.empty());
+    }
+
+    std::optional<stash<>> stream::poll()
+    {
+        const std::lock_guard guard{m_impl->mutex};
+        return m_impl->take();
+    }
+
+    std::optional<stash<>> stream::read()
+    {
+        std::unique_lock lock{m_impl->mutex};
+
+        m_impl->cv.wait(lock,
+                        [this] { return m_impl->cancelled || m_impl->closed || !m_impl->chunks.empty(); });
+
+        return m_impl->take();
+    }
+
+    void stream::cancel()
+    {
+        {
+            const std::lock_guard guard{m_impl->mutex};
+
+            m_impl->cancelled = true;
+            m_impl->buffered  = 0;
+
+            m_impl->chunks.clear();
+            m_impl->ready = nullptr;
+        }
+
+        m_impl->cv.notify_all();
+    }
+
+    void stream::on_ready(std::function<void()> callback)
+    {
+        std::function<void()> previous;
+
+        {
+            std::unique_lock lock{m_impl->mutex};
+            previous = std::exchange(m_impl->ready, std::move(callback));
+
+            // Once the callback was replaced, the previous one is guaranteed to not be running anymore (unless we are
+            // called from within it), which allows its owner to safely go away afterwards.
+
+            m_impl->settled.wait(lock, [this]
+                                 { return !m_impl->notifier || m_impl->notifier == std::this_thread::get_id(); });
+        }
+
+        m_impl->notify();
+    }
+
+    static bool iequals(std::string_view first, std::string_view second)
+    {
+        auto lower = [](unsigned char c)
+        {
+            return std::tolower(c);
+        };
+
+        return std::ranges::equal(first, second, {}, lower, lower);
+    }
+
+    static std::string_view trim(std::string_view value)
+    {
+        const auto start = value.find_first_not_of(" \t");
+
+        if (start == std::string_view::npos)
+        {
+            return {};
+        }
+
+        return value.substr(start, value.find_last_not_of(" \t") - start + 1);
+    }
+
+    static std::optional<std::size_t> parse_offset(std::string_view value)
+    {
+        std::size_t rtn{};
+
+        if (value.empty())
+        {
+            return std::nullopt;
+        }
+
+        const auto [end, ec] = std::from_chars(value.data(), value.data() + value.size(), rtn);
+
+        if (ec != std::errc{} || end != value.data() + value.size())
+        {
+            return std::nullopt;
+        }
+
+        return rtn;
+    }
+
+    std::optional<byte_range> request::range() const
+    {
+        static constexpr std::string_view unit = "bytes=";
+
+        const auto header = this->header("range");
+
+        if (!header.has_value())
+        {
+            return std::nullopt;
+        }
+
+        auto value = header.value();
+
+        if (value.size() <= unit.size() || !iequals(value.substr(0, unit.size()), unit))
+        {
+            return std::nullopt;
+        }
+
+        value.remove_prefix(unit.size());
+
+        const auto separator = value.find('-');
+
+        if (value.contains(',') || separator == std::string_view::npos)
+        {
+            return std::nullopt;
+        }
+
+        const auto start = value.substr(0, separator);
+        const auto end   = value.substr(separator + 1);
+
+        const auto rtn = byte_range{
+            .start = parse_offset(start),
+            .end   = parse_offset(end),
+        };
+
+        if (rtn.start.has_value() != !start.empty() || rtn.end.has_value() != !end.empty())
+        {
+            return std::nullopt;
+        }
+
+        if (!rtn.start && !rtn.end)
+        {
+            return std::nullopt;
+        }
+
+        if (rtn.start && rtn.end && rtn.start.value() > rtn.end.value())
+        {
+            return std::nullopt;
+        }
+
+        return rtn;
+    }
+
+    static double quality(std::string_view params)
+    {
+        for (const auto entry : std::views::split(params, ';'))
+        {
+            const auto param = trim(std::string_view{entry});
+
+            if (param.size() < 2 || !iequals(param.substr(0, 2), "q="))
+            {
+                continue;
+            }
+
+            const auto value = param.substr(2);
+            auto rtn         = 1.0;
+
+            std::from_chars(value.data(), value.data() + value.size(), rtn);
+
+            return rtn;
+        }
+
+        return 1.0;
+    }
+
+    bool request::accepts(encoding encoding) const
+    {
+        if (encoding == encoding::identity)
+        {
+            return true;
+        }
+
+        const auto header = this->header("accept-encoding");
+
+        if (!header.has_value())
+        {
+            return false;
+        }
+
+        const auto name = encoding == encoding::gzip ? std::string_view{"gzip"} : std::string_view{"br"};
+
+        // The most specific entry decides, which is why an explicit token takes precedence over the wildcard regardless
+        // of their order (e.g. "*;q=0, gzip" accepts gzip, "gzip;q=0, *" does not).
+
+        std::optional<bool> exact;
+        std::optional<bool> wildcard;
+
+        for (const auto entry : std::views::split(header.value(), ','))
+        {
+            const auto value = std::string_view{entry};
+
+            const auto params = value.find(';');
+            const auto token  = trim(value.substr(0, params));
+
+            const auto specific = iequals(token, name);
+
+            if (!specific && token != "*")
+            {
+                continue;
+            }
+
+            const auto acceptable = params == std::string_view::npos || quality(value.substr(params + 1)) > 0;
+            auto &match           = specific ? exact : wildcard;
+
+            match = match.value_or(false) || acceptable;
+        }
+
+        return exact.value_or(wildcard.value_or(false));
+    }
+
+    // Qt offers no way of setting the status of a reply. Any 206, 304 or 416 would thus reach the page as a 200 with the
+    // wrong content, which is why partial and conditional answers are not given on Qt at all.
+
+#if defined(SAUCER_QT5) || defined(SAUCER_QT6)
+    static constexpr auto forwards_status = false;
+#else
+    static constexpr auto forwards_status = true;
+#endif
+
+    response ranged(const request &request, response response)
+    {
+        if (!forwards_status || response.stream.has_value())
+        {
+            return response;
+        }
+
+        response.headers.emplace("Accept-Ranges", "bytes");
+
+        if (response.status != 200)
+        {
+            return response;
+        }
+
+        const auto range = request.range();
+
+        if (!range.has_value())
+        {
+            return response;
+        }
+
+        const auto size         = response.data.size();
+        const auto [start, end] = range.value();
+
+        const auto first = start.value_or(size - std::min(end.value_or(0), size));
+        const auto last  = start.has_value() ? std::min(end.value_or(size - 1), size - 1) : size - 1;
+
+        if (first >= size)
+        {
+            response.status = 416;
+            response.data   = stash<>::empty();
+            response.headers.insert_or_assign("Content-Range", fmt::format("bytes */{}", size));
+
+            return response;
+        }
+
+        response.status = 206;
+        response.data   = response.data.slice(first, last - first + 1);
+        response.headers.insert_or_assign("Content-Range", fmt::format("bytes {}-{}/{}", first, last, size));
+
+        return response;
+    }
+
+    static constexpr auto week_days = std::to_array<std::string_view>({"Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"});
+
+    static constexpr auto months = std::to_array<std::string_view>({
+        "Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec",
+    });
+
+    static std::optional<std::chrono::sys_seconds> parse_date(std::string_view value)
+    {
+        // Only IMF-fixdate ("Sun, 06 Nov 1994 08:49:37 GMT") is understood, which is what we hand out ourselves and
+        // what every browser echoes back in `If-Modified-Since`.
+
+        static constexpr std::string_view layout = "Www, DD Mmm YYYY HH:MM:SS GMT";
+
+        if (value.size() != layout.size() || !value.ends_with(" GMT"))
+        {
+            return std::nullopt;
+        }
+
+        auto number = [value](std::size_t offset, std::size_t size)
+        {
+            return parse_offset(value.substr(offset, size));
+        };
+
+        const auto month = std::ranges::find(months, value.substr(8, 3));
+
+        const auto day    = number(5, 2);
+        const auto year   = number(12, 4);
+        const auto hour   = number(17, 2);
+        const auto minute = number(20, 2);
+        const auto second = number(23, 2);
+
+        if (month == months.end() || !day || !year || !hour || !minute || !second)
+        {
+            return std::nullopt;
+        }
+
+        const auto date = std::chrono::year_month_day{
+            std::chrono::year{static_cast<int>(year.value())},
+            std::chrono::month{static_cast<unsigned>(std::distance(months.begin(), month) + 1)},
+            std::chrono::day{static_cast<unsigned>(day.value())},
+        };
+
+        if (!date.ok())
+        {
+            return std::nullopt;
+        }
+
+        const auto time = std::chrono::hours{hour.value()} + std::chrono::minutes{minute.value()} +
+                          std::chrono::seconds{second.value()};
+
+        return std::chrono::sys_days{date} + time;
+    }
+
+    static bool matches(std::string_view header, std::string_view etag)
+    {
+        auto weak = [](std::string_view value)
+        {
+            return value.starts_with("W/") ? value.substr(2) : value;
+        };
+
+        for (const auto entry : std::views::split(header, ','))
+        {
+            const auto value = trim(std::string_view{entry});
+
+            if (value == "*" || weak(value) == weak(etag))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    std::string etag(const stash<> &content)
+    {
+        std::uint64_t hash = 0xcbf29ce484222325;
+
+        for (const auto byte : std::span{content.data(), content.size()})
+        {
+            hash ^= byte;
+            hash *= 0x100000001b3;
+        }
+
+        return fmt::format(R"("{:016x}-{:x}")", hash, content.size());
+    }
+
+    std::string http_date(std::chrono::system_clock::time_point time)
+    {
+        const auto seconds = std::chrono::floor<std::chrono::seconds>(time);
+        const auto days    = std::chrono::floor<std::chrono::days>(seconds);
+
+        const auto date    = std::chrono::year_month_day{days};
+        const auto weekday = std::chrono::weekday{days};
+        const auto clock   = std::chrono::hh_mm_ss{seconds - days};
+
+        return fmt::format("{}, {:02} {} {:04} {:02}:{:02}:{:02} GMT",      //
+                           week_days[weekday.c_encoding()],                 //
+                           static_cast<unsigned>(date.day()),               //
+                           months[static_cast<unsigned>(date.month()) - 1], //
+                           static_cast<int>(date.year()),                   //
+                           clock.hours().count(),                           //
+                           clock.minutes().count(),                         //
+                           clock.seconds().count());
+    }
+
+    response validated(const request &request, response response)
+    {
+        if (!forwards_status || response.status != 200)
+        {
+            return response;
+        }
+
+        const auto method = request.method_view();
+
+        if (!iequals(method, "GET") && !iequals(method, "HEAD"))
+        {
+            return response;
+        }
+
+        const auto etag     = response.headers.find("ETag");
+        const auto modified = response.headers.find("Last-Modified");
+
+        auto unchanged = false;
+
+        // As per RFC 9110 (13.1.3), `If-Modified-Since` is to be ignored when `If-None-Match` is present.
+
+        if (const auto header = request.header("if-none-match"); header.has_value())
+        {
+            unchanged = etag != response.headers.end() && matches(header.value(), etag->second);
+        }
+        else if (const auto since = request.header("if-modified-since"); since && modified != response.headers.end())
+        {
+            const auto last    = parse_date(modified->second);
+            const auto browser = parse_date(since.value());
+
+            unchanged = last && browser && last.value() <= browser.value();
+        }
+
+        if (!unchanged)
+        {
+            return response;
+        }
+
+        if (response.stream.has_value())
+        {
+            response.stream->cancel();
+            response.stream.reset();
+        }
+
+        response.status = 304;
+        response.data   = stash<>::empty();
+
+        return response;
+    }
+
+    stash<> utils::decoder(const stash<> &content, encoding encoding)
+    {
+        if (encoding == encoding::identity)
+        {
+            return stash<>::empty();
+        }
+
+        auto decode = [content, encoding]
+        {
+            return decompress(content, encoding).value_or(stash<>::empty());
+        };
+
+        return stash<>::lazy(std::move(decode));
+    }
+
+    std::expected<response, error> utils::respond(const request &request, const file_view &file, const stash<> &decoded)
+    {
+        auto response = scheme::response{
+            .data    = file.content,
+            .mime    = std::string{file.mime},
+            .headers = {{"Access-Control-Allow-Origin", "*"}},
+        };
+
+        const auto encoded = file.encoding != encoding::identity;
+        const auto decode  = encoded && !request.accepts(file.encoding);
+
+        if (!file.etag.empty())
+        {
+            auto tag = std::string{file.etag};
+
+            // The decoded representation is a different set of bytes and thus requires its own (strong) validator.
+
+            if (decode && tag.ends_with('"'))
+            {
+                tag.insert(tag.size() - 1, "-identity");
+            }
+
+            response.headers.emplace("ETag", std::move(tag));
+            response.headers.emplace("Cache-Control", "no-cache");
+        }
+
+        if (encoded)
+        {
+            response.headers.emplace("Vary", "Accept-Encoding");
+        }
+
+        response = validated(request, std::move(response));
+
+        if (!encoded || response.status == 304)
+        {
+            return ranged(request, std::move(response));
+        }
+
+        // Decoding is only attempted when the encoding is not accepted. Should it fail (e.g. when built without
+        // decompression support) the request is refused, the client would not be able to make sense of the encoded bytes.
+
+        if (decode && decoded.size() == 0 && file.content.size() > 0)
+        {
+            return std::unexpected{error::failed};
+        }
+
+        if (decode)
+        {
+            response.data = decoded;
+        }
+        else
+        {
+            const auto *name = file.encoding == encoding::gzip ? "gzip" : "br";
+            response.headers.emplace("Content-Encoding", name);
+        }
+
+        return ranged(request, std::move(response));
+    }
+
+    std::expected<response, error> utils::respond(const request &request, const embedded_file &file, const stash<> &decoded)
+    {
+        const auto view = file_view{
+            .content  = file.content,
+            .mime     = file.mime,
+            .encoding = file.encoding,
+            .etag     = file.etag,
+        };
+
+        return respond(request, view, decoded);
+    }
+
+    // The spooled body might be sensitive, the file is thus created exclusively (never following or reusing whatever is
+    // already there) and is only accessible by the current user. Without a temporary directory, spooling fails.
+
+    class temporary
+    {
+        fs::path m_path;
+
+#ifdef _WIN32
+        HANDLE m_handle{INVALID_HANDLE_VALUE};
+#else
+        int m_fd{-1};
+#endif
+
+      public:
+        temporary();
+
+      public:
+        temporary(const temporary &) = delete;
+        temporary &operator=(const temporary &) = delete;
+
+      public:
+        ~temporary();
+
+      public:
+        [[nodiscard]] bool valid() const;
+        [[nodiscard]] const fs::path &path() const;
+
+      public:
+        bool close();
+        bool write(const std::uint8_t *, std::size_t);
+    };
+
+#ifdef _WIN32
+    temporary::temporary()
+    {
+        std::error_code ec{};
+        const auto root = fs::temp_directory_path(ec);
+
+        if (ec || root.empty())
+        {
+            return;
+        }
+
+        std::random_device device{};
+        std::array<wchar_t, MAX_PATH> buffer{};
+
+        for (auto attempt = 0; 16 > attempt; ++attempt)
+        {
+            const auto unique = static_cast<UINT>(device() & 0xFFFF) | 1;
+
+            if (!GetTempFileNameW(root.c_str(), L"scr", unique, buffer.data()))
+            {
+                return;
+            }
+
+            m_handle = CreateFileW(buffer.data(), GENERIC_WRITE, 0, nullptr, CREATE_NEW,
+                                   FILE_ATTRIBUTE_TEMPORARY | FILE_ATTRIBUTE_NOT_CONTENT_INDEXED, nullptr);
+
+            if (m_handle != INVALID_HANDLE_VALUE)
+            {
+                m_path = buffer.data();
+                return;
+            }
+
+            if (GetLastError() != ERROR_FILE_EXISTS)
+            {
+                return;
+            }
+        }
+    }
+
+    temporary::~temporary()
+    {
+        close();
+    }
+
+    bool temporary::close()
+    {
+        if (m_handle == INVALID_HANDLE_VALUE)
+        {
+            return true;
+        }
+
+        return CloseHandle(std::exchange(m_handle, INVALID_HANDLE_VALUE));
+    }
+
+    bool temporary::write(const std::uint8_t *data, std::size_t size)
+    {
+        while (size > 0)
+        {
+            const auto chunk = static_cast<DWORD>(std::min<std::size_t>(size, MAXDWORD));
+            DWORD written{};
+
+            if (!WriteFile(m_handle, data, chunk, &written, nullptr) || written == 0)
+            {
+                return false;
+            }
+
+            data += written;
+            size -= written;
+        }
+
+        return true;
+    }
+#else
+    temporary::temporary()
+    {
+        std::error_code ec{};
+        const auto root = fs::temp_directory_path(ec);
+
+        if (ec || root.empty())
+        {
+            return;
+        }
+
+        // mkostemp creates the file with O_CREAT | O_EXCL and a mode of 0600, regardless of the umask.
+
+        auto name = (root / "saucer-XXXXXX").string();
+        m_fd      = mkostemp(name.data(), O_CLOEXEC);
+
+        if (m_fd == -1)
+        {
+            return;
+        }
+
+        m_path = std::move(name);
+    }
+
+    temporary::~temporary()
+    {
+        close();
+    }
+
+    bool temporary::close()
+    {
+        if (m_fd == -1)
+        {
+            return true;
+        }
+
+        return ::close(std::exchange(m_fd, -1)) == 0;
+    }
+
+    bool temporary::write(const std::uint8_t *data, std::size_t size)
+    {
+        while (size > 0)
+        {
+            const auto written = ::write(m_fd, data, size);
+
+            if (written == -1 && errno == EINTR)
+            {
+                continue;
+            }
+
+            if (written <= 0)
+            {
+                return false;
+            }
+
+            data += written;
+            size -= static_cast<std::size_t>(written);
+        }
+
+        return true;
+    }
+#endif
+
+    bool temporary::valid() const
+    {
+        return !m_path.empty();
+    }
+
+    const fs::path &temporary::path() const
+    {
+        return m_path;
+    }
+
+    std::optional<stash<>> spool(const request &request, std::size_t threshold)
+    {
+        std::vector<std::uint8_t> buffer;
+        auto chunk = request.read();
+
+        for (; chunk.has_value() && buffer.size() + chunk->size() <= threshold; chunk = request.read())
+        {
+            buffer.insert(buffer.end(), chunk->data(), chunk->data() + chunk->size());
+        }
+
+        if (!chunk.has_value())
+        {
+            return stash<>::from(std::move(buffer));
+        }
+
+        // The body exceeds the threshold: Everything read so far, and all that follows, is written to a temporary file
+        // which is then mapped. The file is removed once the last reference to the returned stash is released.
+
+        temporary file{};
+
+        if (!file.valid())
+        {
+            return std::nullopt;
+        }
+
+        const auto path = file.path();
+
+        auto remove = [](const fs::path &file)
+        {
+            std::error_code ec{};
+            fs::remove(file, ec);
+        };
+
+        auto good = file.write(buffer.data(), buffer.size());
+        buffer    = {};
+
+        for (; chunk.has_value() && good; chunk = request.read())
+        {
+            good = file.write(chunk->data(), chunk->size());
+        }
+
+        if (!file.close() || !good)
+        {
+            remove(path);
+            return std::nullopt;
+        }
+
+        auto mapped = stash<>::map(path);
+
+        if (!mapped.has_value())
+        {
+            remove(path);
+            return std::nullopt;
+        }
+
+        auto release = [path, remove](stash<> *data)
+        {
+            delete data;
+            remove(path);
+        };
+
+        auto owner       = std::shared_ptr<stash<>>{new stash<>{std::move(mapped.value())}, release};
+        const auto *data = owner->data();
+
+        return stash<>::share(owner, {data, data + owner->size()});
+    }
+
+    struct directory::impl
+    {
+        struct entry
+        {
+            stash<> content;
+            std::string etag;
+            std::string modified;
+
+          public:
+            std::uintmax_t size;
+            fs::file_time_type time;
+            std::uint64_t used;
+        };
+
+        struct store
+        {
+            std::unordered_map<std::string, entry> entries;
+            std::uint64_t tick{0};
+        };
+
+      public:
+        static constexpr auto capacity = 64uz;
+
+      public:
+        fs::path root;
+
+      public:
+        lockpp::lock<store> cache;
+
+      public:
+        [[nodiscard]] std::optional<fs::path> resolve(std::string_view url) const;
+        [[nodiscard]] std::optional<entry> open(const fs::path &file);
+    };
+
+    static std::optional<stash<>> load(const fs::path &file)
+    {
+        std::ifstream stream{file, std::ios::binary | std::ios::ate};
+        const auto size = stream ? static_cast<std::streamoff>(stream.tellg()) : -1;
+
+        if (size < 0)
+        {
+            return std::nullopt;
+        }
+
+        std::vector<std::uint8_t> rtn(static_cast<std::size_t>(size));
+
+        stream.seekg(0);
+        stream.read(reinterpret_cast<char *>(rtn.data()), static_cast<std::streamsize>(rtn.size()));
+
+        rtn.resize(static_cast<std::size_t>(stream.gcount()));
+
+        return stash<>::from(std::move(rtn));
+    }
+
+    std::optional<std::string> utils::path(std::string_view url)
+    {
+        const auto scheme = url.find("://");
+
+        if (scheme == std::string_view::npos)
+        {
+            return std::nullopt;
+        }
+
+        const auto start = url.find('/', scheme + 3);
+        auto path        = start == std::string_view::npos ? std::string_view{"/"} : url.substr(start);
+
+        auto decoded = decode(path.substr(0, path.find_first_of("?#")));
+
+        if (!decoded.has_value())
+        {
+            return std::nullopt;
+        }
+
+        if (decoded->ends_with('/'))
+        {
+            decoded->append("index.html");
+        }
+
+        const auto relative = fs::path{decoded.value()}.relative_path().lexically_normal();
+
+        if (relative.empty() || relative.has_root_path() || *relative.begin() == "..")
+        {
+            return std::nullopt;
+        }
+
+        return relative.generic_string();
+    }
+
+    std::optional<fs::path> directory::impl::resolve(std::string_view url) const
+    {
+        const auto path = utils::path(url);
+
+        if (!path.has_value())
+        {
+            return std::nullopt;
+        }
+
+        std::error_code ec{};
+        auto rtn = fs::weakly_canonical(root / path.value(), ec);
+
+        if (ec)
+        {
+            return std::nullopt;
+        }
+
+        // The path itself can not leave the root anymore, a symbolic link within the root however still could.
+
+        const auto [it, _] = std::ranges::mismatch(root, rtn);
+
+        if (it != root.end())
+        {
+            return std::nullopt;
+        }
+
+        return rtn;
+    }
+
+    std::optional<directory::impl::entry> directory::impl::open(const fs::path &file)
+    {
+        const auto key = file.string();
+
+        std::error_code ec{};
+
+        const auto size = fs::file_size(file, ec);
+        const auto time = ec ? fs::file_time_type{} : fs::last_write_time(file, ec);
+
+        if (ec)
+        {
+            return std::nullopt;
+        }
+
+        // Entries are only re-used as long as the file keeps its size and modification time, a file that was rewritten
+        // in the meantime is opened anew so that neither stale content nor an outdated ETag is served.
+
+        bool rewritten{false};
+
+        if (auto locked = cache.write(); locked->entries.contains(key))
+        {
+            auto &cached = locked->entries.at(key);
+
+            if (cached.size == size && cached.time == time)
+            {
+                cached.used = ++locked->tick;
+                return cached;
+            }
+
+            rewritten = true;
+        }
+
+        // Truncating a file while it is mapped makes every access past its new end fault (SIGBUS on POSIX), which is
+        // why files that were already changed while being served (e.g. by an editor that saves in place) are read into
+        // memory instead. A file that is truncated while its very first mapping is still being read remains a hazard.
+
+        auto content = rewritten ? load(file) : stash<>::map(file);
+
+        if (!content.has_value())
+        {
+            return std::nullopt;
+        }
+
+        // `clock_cast` is not yet available everywhere, so we translate the file time by hand.
+        const auto system = std::chrono::system_clock::now() + (time - fs::file_time_type::clock::now());
+        const auto stamp  = static_cast<std::uint64_t>(time.time_since_epoch().count());
+
+        auto rtn = entry{
+            .content  = std::move(content.value()),
+            .etag     = fmt::format(R"(W/"{:x}-{:x}")", stamp, size),
+            .modified = http_date(std::chrono::time_point_cast<std::chrono::system_clock::duration>(system)),
+            .size     = size,
+            .time     = time,
+            .used     = 0,
+        };
+
+        auto locked = cache.write();
+        rtn.used    = ++locked->tick;
+
+        if (locked->entries.size() >= capacity && !locked->entries.contains(key))
+        {
+            auto oldest = std::ranges::min_element(locked->entries, {}, [](const auto &item) { return item.second.used; });
+            locked->entries.erase(oldest);
+        }
+
+        return locked->entries.insert_or_assign(key, std::move(rtn)).first->second;
+    }
+
+    directory::directory(fs::path root) : m_impl(std::make_shared<impl>())
+    {
+        std::error_code ec{};
+        auto canonical = fs::weakly_canonical(root, ec);
+
+        if (ec)
+        {
+            canonical = root.lexically_normal();
+        }
+
+        // A trailing separator would leave an empty last element, which no resolved file could ever match.
+
+        if (!canonical.has_filename())
+        {
+            canonical = canonical.parent_path();
+        }
+
+        m_impl->root = std::move(canonical);
+    }
+
+    std::expected<response, error> directory::operator()(const request &request) const
+    {
+        const auto file = m_impl->resolve(request.url_view());
+
+        if (!file.has_value())
+        {
+            return std::unexpected{error::invalid};
+        }
+
+        auto entry = m_impl->open(file.value());
+
+        if (!entry.has_value())
+        {
+            return std::unexpected{error::not_found};
+        }
+
+        auto response = scheme::response{
+            .data    = std::move(entry->content),
+            .mime    = utils::mime(file.value()),
+            .headers = {{"Access-Control-Allow-Origin", "*"}},
+        };
+
+        response.headers.emplace("ETag", std::move(entry->etag));
+        response.headers.emplace("Last-Modified", std::move(entry->modified));
+        response.headers.emplace("Cache-Control", "no-cache");
+
+        return ranged(request, validated(request, std::move(response)));
+    }
+} // namespace saucer::scheme
@@ -0,0 +1,62 @@
+#include "script_batch.hpp"
+
+#include <utility>
+#include <iterator>
+#include <algorithm>
+
+#include <fmt/core.h>
+
+namespace saucer::utils
+{
+    script_batch::script_batch(application *parent, runner run) : m_parent(parent), m_run(std::move(run)) {}
+
+    batch_stats script_batch::stats() const
+    {
+        return m_stats;
+    }
+
+    void script_batch::push(const std::string &code)
+    {
+        // Each script is guarded on its own so that an exception thrown by one of them does not prevent the
+        // remaining scripts of the batch from running. The line break keeps trailing line-comments from leaking.
+
+        fmt::format_to(std::back_inserter(m_code), "try {{ {}\n}} catch (error) {{ console.error(error); }}\n", code);
+
+        if (m_size++ != 0)
+        {
+            return;
+        }
+
+        // The batch is flushed once the main thread gets back to its event loop, i.e. after all scripts that are
+        // executed in the same iteration were collected. The batch might be gone by then along with its webview.
+
+        m_parent->post(
+            [batch = weak_from_this()]
+            {
+                auto self = batch.lock();
+
+                if (!self)
+                {
+                    return;
+                }
+
+                self->flush();
+            });
+    }
+
+    void script_batch::flush()
+    {
+        if (m_size == 0)
+        {
+            return;
+        }
+
+        m_stats.batches++;
+        m_stats.scripts += m_size;
+        m_stats.largest = std::max(m_stats.largest, m_size);
+
+        m_size = 0;
+
+        std::invoke(m_run, std::exchange(m_code, {}));
+    }
+} // namespace saucer::utils
@@ -1,6 +1,16 @@
 #include "smartview.hpp"
 
+#include "request.hpp"
 #include "scripts.hpp"
+#include "slot_map.hpp"
+#include "snapshot.hpp"
+
+#include <queue>
+#include <utility>
+#include <mutex>
+#include <thread>
+#include <system_error>
+#include <condition_variable>
 
 #include <lockpp/lock.hpp>
 #include <fmt/core.h>
@@ -8,6 +18,8 @@
 namespace saucer
 {
     using lockpp::lock;
+    using utils::slot_map;
+    using utils::snapshot;
 
     using resolver = saucer::serializer::resolver;
     using function = saucer::serializer::function;
@@ -17,14 +29,237 @@ namespace saucer
         using exposed = std::shared_ptr<std::pair<function, launch>>;
 
       public:
-        lock<std::unordered_map<std::string, exposed>> functions;
-        lock<std::unordered_map<std::uint64_t, resolver>> evaluations;
+        struct registry
+        {
+            std::vector<std::pair<std::string, exposed>> functions;
+            std::unordered_map<std::string, std::uint64_t> ids;
+
+          public:
+            [[nodiscard]] std::optional<std::uint64_t> find(const function_id &) const;
+        };
+
+      public:
+        struct evaluation
+        {
+            resolver resolve;
+            std::uint64_t page;
+
+          public:
+            std::move_only_function<void(std::exception_ptr)> expire;
+        };
+
+        struct expiry
+        {
+            using clock    = std::chrono::steady_clock;
+            using deadline = std::pair<clock::time_point, std::uint64_t>;
+
+          public:
+            std::mutex mutex;
+            std::condition_variable cv;
+            std::priority_queue<deadline, std::vector<deadline>, std::greater<>> queue;
+
+          public:
+            bool stop{false};
+            std::thread reaper;
+        };
+
+      public:
+        snapshot<registry> functions;
+        lock<slot_map<evaluation>> evaluations;
+
+      public:
+        bool ready{false};
+        std::uint64_t page{0};
+
+      public:
+        expiry timeouts;
+        std::optional<script> stubs;
 
       public:
         std::unique_ptr<saucer::serializer> serializer;
         std::shared_ptr<lockpp::lock<smartview_core *>> self;
+
+      public:
+        ~impl();
+
+      public:
+        void reap();
+        void expire(std::uint64_t, std::chrono::milliseconds);
+
+      public:
+        void publish(smartview_core &);
+        void refresh(smartview_core &);
+
+      public:
+        static std::string stub(const std::string &, std::uint64_t);
+        static std::string unstub(const std::string &);
     };
 
+    smartview_core::impl::~impl()
+    {
+        {
+            const std::lock_guard guard{timeouts.mutex};
+            timeouts.stop = true;
+        }
+
+        timeouts.cv.notify_one();
+
+        if (!timeouts.reaper.joinable())
+        {
+            return;
+        }
+
+        timeouts.reaper.join();
+    }
+
+    void smartview_core::impl::reap()
+    {
+        std::unique_lock guard{timeouts.mutex};
+
+        while (!timeouts.stop)
+        {
+            if (timeouts.queue.empty())
+            {
+                timeouts.cv.wait(guard);
+                continue;
+            }
+
+            const auto [deadline, id] = timeouts.queue.top();
+
+            if (expiry::clock::now() < deadline)
+            {
+                timeouts.cv.wait_until(guard, deadline);
+                continue;
+            }
+
+            timeouts.queue.pop();
+
+            // Evaluations that were resolved in the meantime are simply not found anymore.
+
+            auto expired = evaluations.write()->take(id);
+
+            if (!expired)
+            {
+                continue;
+            }
+
+            // Settling the evaluation (and dropping its resolver) runs user continuations, which may very well start
+            // another timed evaluation and thus require the lock.
+
+            guard.unlock();
+
+            const auto error = std::make_error_code(std::errc::timed_out);
+
+            std::invoke(expired->expire, std::make_exception_ptr(std::system_error{error, "Evaluation timed out"}));
+            expired.reset();
+
+            guard.lock();
+        }
+    }
+
+    void smartview_core::impl::expire(std::uint64_t id, std::chrono::milliseconds timeout)
+    {
+        {
+            const std::lock_guard guard{timeouts.mutex};
+
+            if (!timeouts.reaper.joinable())
+            {
+                timeouts.reaper = std::thread{&impl::reap, this};
+            }
+
+            timeouts.queue.emplace(expiry::clock::now() + timeout, id);
+        }
+
+        timeouts.cv.notify_one();
+    }
+
+    std::optional<std::uint64_t> smartview_core::impl::registry::find(const function_id &function) const
+    {
+        overload visitor = {
+            [](std::uint64_t id) { return id; },
+            [this](const std::string &name) -> std::uint64_t
+            {
+                const auto it = ids.find(name);
+                return it != ids.end() ? it->second : functions.size();
+            },
+        };
+
+        const auto id = std::visit(visitor, function);
+
+        if (id >= functions.size() || !functions[id].second)
+        {
+            return std::nullopt;
+        }
+
+        return id;
+    }
+
+    void smartview_core::impl::publish(smartview_core &parent)
+    {
+        if (!parent.m_parent->thread_safe())
+        {
+            auto callback = [shared = self]
+            {
+                auto locked = shared->read();
+
+                if (!locked.value())
+                {
+                    return;
+                }
+
+                locked.value()->m_impl->publish(*locked.value());
+            };
+
+            return parent.m_parent->post(std::move(callback));
+        }
+
+        refresh(parent);
+    }
+
+    void smartview_core::impl::refresh(smartview_core &parent)
+    {
+        const auto registry = functions.load();
+        std::string code;
+
+        for (auto id = 0uz; registry->functions.size() > id; ++id)
+        {
+            const auto &[name, exposed] = registry->functions[id];
+
+            if (!exposed)
+            {
+                continue;
+            }
+
+            code += stub(name, id);
+        }
+
+        // All stubs live in a single permanent script, which is replaced whenever the exposed functions change. Removed
+        // functions thus no longer leave stale stubs behind on pages that are loaded later on.
+
+        if (stubs)
+        {
+            parent.uninject(std::exchange(stubs, std::nullopt).value());
+        }
+
+        if (code.empty())
+        {
+            return;
+        }
+
+        stubs.emplace(script{.code = std::move(code), .time = load_time::creation, .permanent = true});
+        parent.inject(stubs.value());
+    }
+
+    std::string smartview_core::impl::stub(const std::string &name, std::uint64_t id)
+    {
+        return fmt::format("window.saucer.internal.register({:?}, {});", name, id);
+    }
+
+    std::string smartview_core::impl::unstub(const std::string &name)
+    {
+        return fmt::format("window.saucer.internal.unregister({:?});", name);
+    }
+
     smartview_core::smartview_core(std::unique_ptr<serializer> serializer, const preferences &prefs)
         : webview(prefs), m_impl(std::make_unique<impl>())
     {
@@ -45,15 +280,13 @@ namespace saucer
         *locked     = nullptr;
     }
 
-    bool smartview_core::on_message(const std::string &message)
+    bool smartview_core::on_message(std::string_view message)
     {
         if (webview::on_message(message))
         {
             return true;
         }
 
-        auto parsed = m_impl->serializer->parse(message);
-
         overload visitor = {
             [](std::monostate &) { return false; },
             [this](std::unique_ptr<function_data> &parsed)
@@ -68,20 +301,114 @@ namespace saucer
             },
         };
 
-        return std::visit(visitor, parsed);
+        const auto batch = request::split(message);
+
+        if (!batch)
+        {
+            auto parsed = m_impl->serializer->parse(message);
+            return std::visit(visitor, parsed);
+        }
+
+        auto handled = false;
+
+        for (const auto &entry : batch.value())
+        {
+            auto parsed = m_impl->serializer->parse(entry);
+            handled     = std::visit(visitor, parsed) || handled;
+        }
+
+        return handled;
+    }
+
+    bool smartview_core::on_binary(stash<> data)
+    {
+        if (webview::on_binary(data))
+        {
+            return true;
+        }
+
+        const auto frame = request::unpack(data);
+
+        if (!frame)
+        {
+            return false;
+        }
+
+        auto parsed         = m_impl->serializer->parse(frame->header);
+        auto *const message = std::get_if<std::unique_ptr<function_data>>(&parsed);
+
+        if (!message)
+        {
+            return false;
+        }
+
+        auto &buffers = message->get()->buffers;
+        buffers.reserve(frame->buffers.size());
+
+        // The buffers are handed out as slices of the frame, which thus stays alive (and is never copied) for as long
+        // as any of its buffers is still in use.
+
+        for (const auto &buffer : frame->buffers)
+        {
+            buffers.emplace_back(data.slice(static_cast<std::size_t>(buffer.data() - data.data()), buffer.size()));
+        }
+
+        call(std::move(*message));
+
+        return true;
+    }
+
+    void smartview_core::on_load(const state &state)
+    {
+        if (state == state::started)
+        {
+            m_impl->ready = false;
+
+            // The page we are leaving will never resolve the evaluations it received. Dropping their resolvers breaks
+            // the respective promises, which lets the futures fail instead of waiting forever.
+
+            auto dropped = m_impl->evaluations.write()->take_if([page = m_impl->page](const auto &evaluation)
+                                                                { return evaluation.page <= page; });
+        }
+
+        webview::on_load(state);
+    }
+
+    void smartview_core::on_dom_ready()
+    {
+        m_impl->ready = true;
+        m_impl->page++;
+
+        webview::on_dom_ready();
     }
 
     void smartview_core::call(std::unique_ptr<function_data> message)
     {
-        impl::exposed exposed;
+        const auto registry = m_impl->functions.load();
+        const auto index    = registry->find(message->function);
 
-        if (auto locked = m_impl->functions.write(); locked->contains(message->name))
+        if (!index)
         {
-            exposed = locked->at(message->name);
+            overload describe = {
+                [&registry](std::uint64_t id)
+                {
+                    // Ids are never re-used, so even a function that has since been cleared still has its name around.
+                    return id < registry->functions.size() ? registry->functions[id].first : fmt::format("#{}", id);
+                },
+                [](const std::string &name) { return name; },
+            };
+
+            const auto name = std::visit(describe, message->function);
+            return reject(message->id, fmt::format("\"No exposed function '{}'\"", name));
         }
-        else
+
+        const auto &[name, exposed] = registry->functions[index.value()];
+
+        if (std::holds_alternative<std::string>(message->function))
         {
-            return reject(message->id, fmt::format("\"No exposed function '{}'\"", message->name));
+            // The page does not know the id of this function yet (e.g. because it was called before the stubs were
+            // pushed), so we hand it out now to let subsequent calls skip the name lookup.
+            webview::execute(impl::stub(name, index.value()));
         }
 
         auto resolve = [shared = m_impl->self, id = message->id](const auto &result)
@@ -116,38 +443,97 @@ namespace saucer
             return std::invoke(exposed->first, std::move(message), executor);
         }
 
-        m_parent->pool().emplace(
-            [exposed = std::move(exposed), message = std::move(message), executor = std::move(executor)]() mutable
-            { std::invoke(exposed->first, std::move(message), executor); });
+        m_parent->pool().emplace([exposed, message = std::move(message), executor = std::move(executor)]() mutable
+                                 { std::invoke(exposed->first, std::move(message), executor); });
     }
 
     void smartview_core::resolve(std::unique_ptr<result_data> message)
     {
-        const auto id = message->id;
-        auto evals    = m_impl->evaluations.write();
+        auto evaluation = m_impl->evaluations.write()->take(message->id);
 
-        if (!evals->contains(id))
+        if (!evaluation)
         {
             return;
         }
 
-        std::invoke(evals->at(id), std::move(message));
-        evals->erase(id);
+        std::invoke(evaluation->resolve, std::move(message));
     }
 
     void smartview_core::add_function(std::string name, function &&resolve, launch policy)
     {
-        auto functions = m_impl->functions.write();
-        functions->emplace(std::move(name), std::make_shared<impl::exposed::element_type>(std::move(resolve), policy));
+        auto exposed = std::make_shared<impl::exposed::element_type>(std::move(resolve), policy);
+
+        std::optional<std::uint64_t> id;
+
+        m_impl->functions.update(
+            [&](impl::registry &registry)
+            {
+                auto [it, inserted] = registry.ids.try_emplace(name, registry.functions.size());
+
+                if (inserted)
+                {
+                    registry.functions.emplace_back(name, nullptr);
+                }
+
+                auto &current = registry.functions[it->second].second;
+
+                if (current)
+                {
+                    return;
+                }
+
+                current = std::move(exposed);
+                id      = it->second;
+            });
+
+        if (!id)
+        {
+            return;
+        }
+
+        m_impl->publish(*this);
+        webview::execute(impl::stub(name, id.value()));
     }
 
-    void smartview_core::add_evaluation(resolver &&resolve, const std::string &code)
+    void smartview_core::add_evaluation(resolver &&resolve, const std::string &code, std::optional<deadline> timeout)
     {
-        auto id = m_id_counter++;
+        if (!m_parent->thread_safe())
+        {
+            // Blocking until the main thread got to the evaluation would dead-lock callers that are themselves awaited
+            // by the main thread, the evaluation is thus merely handed over.
+
+            auto callback = [shared = m_impl->self, resolve = std::move(resolve), code,
+                             timeout = std::move(timeout)]() mutable
+            {
+                auto self = shared->read();
 
+                if (!self.value())
+                {
+                    return;
+                }
+
+                self.value()->add_evaluation(std::move(resolve), code, std::move(timeout));
+            };
+
+            return m_parent->post(std::move(callback));
+        }
+
+        // Scripts executed before the dom is ready are deferred until the next page has loaded, which is why their
+        // evaluations belong to the next page rather than the current one.
+
+        const auto page = m_impl->ready ? m_impl->page : m_impl->page + 1;
+        impl::evaluation evaluation{std::move(resolve), page};
+
+        if (timeout)
+        {
+            evaluation.expire = std::move(timeout->expire);
+        }
+
+        const auto id = m_impl->evaluations.write()->emplace(std::move(evaluation));
+
+        if (timeout)
         {
-            auto locked = m_impl->evaluations.write();
-            locked->emplace(id, std::move(resolve));
+            m_impl->expire(id, timeout->timeout);
         }
 
         webview::execute(fmt::format(
@@ -161,13 +547,60 @@ namespace saucer
 
     void smartview_core::clear_exposed()
     {
-        auto locked = m_impl->functions.write();
-        locked->clear();
+        std::vector<std::string> removed;
+
+        m_impl->functions.update(
+            [&removed](impl::registry &registry)
+            {
+                for (auto &[name, exposed] : registry.functions)
+                {
+                    if (!exposed)
+                    {
+                        continue;
+                    }
+
+                    removed.emplace_back(name);
+                    exposed.reset();
+                }
+            });
+
+        if (removed.empty())
+        {
+            return;
+        }
+
+        m_impl->publish(*this);
+
+        for (const auto &name : removed)
+        {
+            webview::execute(impl::unstub(name));
+        }
     }
 
     void smartview_core::clear_exposed(const std::string &name)
     {
-        auto locked = m_impl->functions.write();
-        locked->erase(name);
+        bool removed{false};
+
+        m_impl->functions.update(
+            [&name, &removed](impl::registry &registry)
+            {
+                if (!registry.ids.contains(name))
+                {
+                    return;
+                }
+
+                auto &exposed = registry.functions[registry.ids.at(name)].second;
+                removed       = static_cast<bool>(exposed);
+
+                exposed.reset();
+            });
+
+        if (!removed)
+        {
+            return;
+        }
+
+        m_impl->publish(*this);
+        webview::execute(impl::unstub(name));
     }
 } // namespace saucer
@@ -0,0 +1,105 @@
+#include "stash/stash.hpp"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+namespace saucer::impl
+{
+#ifdef _WIN32
+    std::optional<mapping> map(const fs::path &file)
+    {
+        auto *const handle = CreateFileW(file.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                         FILE_ATTRIBUTE_NORMAL, nullptr);
+
+        if (handle == INVALID_HANDLE_VALUE)
+        {
+            return std::nullopt;
+        }
+
+        LARGE_INTEGER size{};
+
+        if (!GetFileSizeEx(handle, &size))
+        {
+            CloseHandle(handle);
+            return std::nullopt;
+        }
+
+        if (size.QuadPart == 0)
+        {
+            CloseHandle(handle);
+            return mapping{.owner = nullptr, .data = {}};
+        }
+
+        auto *const section = CreateFileMappingW(handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(handle);
+
+        if (!section)
+        {
+            return std::nullopt;
+        }
+
+        auto *const view = MapViewOfFile(section, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(section);
+
+        if (!view)
+        {
+            return std::nullopt;
+        }
+
+        auto owner       = std::shared_ptr<const void>{view, [](const void *ptr) { UnmapViewOfFile(ptr); }};
+        const auto *data = static_cast<const std::uint8_t *>(view);
+
+        return mapping{.owner = std::move(owner), .data = {data, static_cast<std::size_t>(size.QuadPart)}};
+    }
+#else
+    std::optional<mapping> map(const fs::path &file)
+    {
+        const auto fd = open(file.c_str(), O_RDONLY | O_CLOEXEC);
+
+        if (fd < 0)
+        {
+            return std::nullopt;
+        }
+
+        struct stat info{};
+
+        if (fstat(fd, &info) != 0 || !S_ISREG(info.st_mode))
+        {
+            close(fd);
+            return std::nullopt;
+        }
+
+        const auto size = static_cast<std::size_t>(info.st_size);
+
+        if (size == 0)
+        {
+            close(fd);
+            return mapping{.owner = nullptr, .data = {}};
+        }
+
+        auto *const view = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+
+        if (view == MAP_FAILED)
+        {
+            return std::nullopt;
+        }
+
+        auto release = [size](const void *ptr)
+        {
+            munmap(const_cast<void *>(ptr), size);
+        };
+
+        auto owner       = std::shared_ptr<const void>{view, release};
+        const auto *data = static_cast<const std::uint8_t *>(view);
+
+        return mapping{.owner = std::move(owner), .data = {data, size}};
+    }
+#endif
+} // namespace saucer::impl
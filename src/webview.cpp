@@ -1,5 +1,8 @@
 #include "webview.hpp"
 #include "request.hpp"
+#include "scheduler.hpp"
+#include "script_batch.hpp"
+#include "scheme.utils.hpp"
 
 #include <algorithm>
 
@@ -7,7 +10,7 @@
 
 namespace saucer
 {
-    bool webview::on_message(const std::string &message)
+    bool webview::on_message(std::string_view message)
     {
         if (std::ranges::any_of(modules(), [&message](auto &module) { return module.template invoke<0>(message); }))
         {
@@ -36,64 +39,194 @@ namespace saucer
         return true;
     }
 
+    bool webview::on_binary(stash<>)
+    {
+        return false;
+    }
+
+    void webview::on_load(const state &state)
+    {
+        m_events.at<web_event::load>().fire(state);
+    }
+
+    void webview::on_dom_ready()
+    {
+        m_events.at<web_event::dom_ready>().fire();
+    }
+
     void webview::reject(std::uint64_t id, const std::string &reason)
     {
-        execute(fmt::format(
-            R"(
-                window.saucer.internal.rpc[{0}].reject({1});
-                delete window.saucer.internal.rpc[{0}];
-            )",
-            id, reason));
+        execute(fmt::format(R"(window.saucer.internal.settle({}, "reject", {});)", id, reason));
     }
 
     void webview::resolve(std::uint64_t id, const std::string &result)
     {
-        execute(fmt::format(
-            R"(
-                window.saucer.internal.rpc[{0}].resolve({1});
-                delete window.saucer.internal.rpc[{0}];
-            )",
-            id, result));
+        execute(fmt::format(R"(window.saucer.internal.settle({}, "resolve", {});)", id, result));
     }
 
-    void webview::embed(embedded_files files, launch policy)
+    void webview::handle_scheme(const std::string &name, scheme::resolver &&resolver, scheme::limits limits)
     {
         if (!m_parent->thread_safe())
         {
-            return m_parent->dispatch([this, files = std::move(files)]() mutable { return embed(std::move(files)); });
+            return m_parent->dispatch([this, name, handler = std::move(resolver), limits] mutable
+                                      { return handle_scheme(name, std::move(handler), limits); });
         }
 
-        m_embedded_files.merge(std::move(files));
+        if (!m_scheduler)
+        {
+            m_scheduler = std::make_shared<utils::scheduler>(m_parent.get());
+        }
+
+        // Requests are only queued on the main thread, the scheduler then hands them to the thread-pool once the scheme
+        // (and the pool) have room for them.
+
+        handle_scheme(name, m_scheduler->wrap(name, std::move(resolver), limits), launch::sync);
+    }
+
+    std::expected<scheme::response, scheme::error> webview::embedded(const scheme::request &request) const
+    {
+        static constexpr std::string_view prefix = "/embedded/";
+
+        const auto url   = request.url_view();
+        const auto start = url.find(prefix);
+
+        if (start == std::string_view::npos)
+        {
+            return std::unexpected{scheme::error::invalid};
+        }
+
+        auto file = url.substr(start + prefix.size());
+        file      = file.substr(0, file.find_first_of("#?"));
 
-        auto func = [this](const auto &request) -> std::expected<scheme::response, scheme::error>
+        if (file.empty())
         {
-            static constexpr std::string_view prefix = "/embedded/";
+            return std::unexpected{scheme::error::invalid};
+        }
 
-            const auto url   = request.url();
-            const auto start = url.find(prefix) + prefix.size();
+        for (const auto &[assets, slots, removed] : m_embedded_tables)
+        {
+            const auto index = assets.index_of(file);
 
-            if (start >= url.size())
+            if (!index.has_value() || removed[index.value()])
             {
-                return std::unexpected{scheme::error::invalid};
+                continue;
             }
 
-            const auto file = url.substr(start, url.find_first_of("#?") - start);
+            const auto &asset  = assets.entries()[index.value()];
+            const auto content = stash<>::view(asset.content);
+
+            // The etag (unless it was generated ahead of time) and the decoder are only set up once the asset is first
+            // requested, embedding a table thus never touches the contents of assets that are not served.
+
+            auto &slot = slots[index.value()];
+
+            std::call_once(slot.init,
+                           [&]
+                           {
+                               slot.etag    = asset.etag.empty() ? scheme::etag(content) : std::string{asset.etag};
+                               slot.decoded = scheme::utils::decoder(content, asset.encoding);
+                           });
+
+            const auto data = scheme::utils::file_view{
+                .content  = content,
+                .mime     = asset.mime,
+                .encoding = asset.encoding,
+                .etag     = slot.etag,
+            };
+
+            return scheme::utils::respond(request, data, slot.decoded);
+        }
+
+        const auto name = std::string{file};
+        const auto it   = m_embedded_files.find(name);
+
+        if (it == m_embedded_files.end())
+        {
+            return std::unexpected{scheme::error::not_found};
+        }
+
+        const auto decoded = m_decoded_files.find(name);
+
+        if (decoded == m_decoded_files.end())
+        {
+            return scheme::utils::respond(request, it->second, stash<>::empty());
+        }
+
+        return scheme::utils::respond(request, it->second, decoded->second);
+    }
+
+    batch_stats webview::execute_stats() const
+    {
+        if (!m_parent->thread_safe())
+        {
+            return m_parent->dispatch([this] { return execute_stats(); });
+        }
+
+        if (!m_batch)
+        {
+            return {};
+        }
+
+        return m_batch->stats();
+    }
+
+    std::optional<scheme_stats> webview::handler_stats(const std::string &name) const
+    {
+        if (!m_parent->thread_safe())
+        {
+            return m_parent->dispatch([this, name] { return handler_stats(name); });
+        }
+
+        if (!m_scheduler)
+        {
+            return std::nullopt;
+        }
+
+        return m_scheduler->stats(name);
+    }
+
+    void webview::embed(embedded_files files, launch policy)
+    {
+        if (!m_parent->thread_safe())
+        {
+            return m_parent->dispatch([this, files = std::move(files), policy]() mutable
+                                      { return embed(std::move(files), policy); });
+        }
+
+        m_embedded_files.merge(std::move(files));
 
-            if (!m_embedded_files.contains(file))
+        for (auto &[name, file] : m_embedded_files)
+        {
+            if (file.etag.empty())
             {
-                return std::unexpected{scheme::error::not_found};
+                file.etag = scheme::etag(file.content);
             }
 
-            const auto &data = m_embedded_files.at(file);
+            if (file.encoding == scheme::encoding::identity || m_decoded_files.contains(name))
+            {
+                continue;
+            }
 
-            return scheme::response{
-                .data    = data.content,
-                .mime    = data.mime,
-                .headers = {{"Access-Control-Allow-Origin", "*"}},
-            };
-        };
+            m_decoded_files.emplace(name, scheme::utils::decoder(file.content, file.encoding));
+        }
 
-        handle_scheme("saucer", func, policy);
+        handle_scheme("saucer", [this](const auto &request) { return embedded(request); }, policy);
+    }
+
+    void webview::embed(embedded_assets assets, launch policy)
+    {
+        if (!m_parent->thread_safe())
+        {
+            return m_parent->dispatch([this, assets, policy] { return embed(assets, policy); });
+        }
+
+        m_embedded_tables.emplace_back(embedded_table{
+            .assets  = assets,
+            .slots   = std::make_unique<embedded_slot[]>(assets.size()),
+            .removed = std::vector<bool>(assets.size(), false),
+        });
+
+        handle_scheme("saucer", [this](const auto &request) { return embedded(request); }, policy);
     }
 
     void webview::serve(const std::string &file)
@@ -109,6 +242,9 @@ namespace saucer
         }
 
         m_embedded_files.clear();
+        m_decoded_files.clear();
+        m_embedded_tables.clear();
+
         remove_scheme("saucer");
     }
 
@@ -120,5 +256,18 @@ namespace saucer
         }
 
         m_embedded_files.erase(file);
+        m_decoded_files.erase(file);
+
+        for (auto &[assets, slots, removed] : m_embedded_tables)
+        {
+            const auto index = assets.index_of(file);
+
+            if (!index.has_value())
+            {
+                continue;
+            }
+
+            removed[index.value()] = true;
+        }
     }
 } // namespace saucer
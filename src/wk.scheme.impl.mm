@@ -28,10 +28,15 @@ void saucer::scheme::init_objc()
                 auto handle = [&]
                 {
                     auto locked = self->m_tasks.write();
-                    return locked->emplace(task.hash, ref).first->first;
+                    return locked->emplace(task.hash, task_entry{.task = ref, .stream = nullptr}).first->first;
                 }();
 
-                auto resolve = [self, handle](const scheme::response &response)
+                auto &[app, policy, resolver, completions] = self->m_callbacks.at(instance);
+
+                // WebKit expects the task to only be used from the main thread, which is why the pump does its work there.
+                // It deliberately captures neither the stream nor the task, both are looked up by their handle instead.
+
+                auto pump = [self, handle]
                 {
                     const utils::autorelease_guard guard{};
 
@@ -42,34 +47,89 @@ void saucer::scheme::init_objc()
                         return;
                     }
 
-                    auto task          = tasks->at(handle);
-                    const auto content = response.data;
+                    auto &[task, source] = tasks->at(handle);
 
-                    auto *const data = [NSData dataWithBytes:content.data() length:static_cast<NSInteger>(content.size())];
-                    auto *const headers = [[[NSMutableDictionary<NSString *, NSString *> alloc] init] autorelease];
+                    while (auto chunk = source->poll())
+                    {
+                        [task.get() didReceiveData:[NSData dataWithBytes:chunk->data()
+                                                                  length:static_cast<NSInteger>(chunk->size())]];
+                    }
 
-                    for (const auto &[key, value] : response.headers)
+                    if (!source->finished())
                     {
-                        [headers setObject:[NSString stringWithUTF8String:value.c_str()]
-                                    forKey:[NSString stringWithUTF8String:key.c_str()]];
+                        return;
                     }
 
-                    auto *const mime   = [NSString stringWithUTF8String:response.mime.c_str()];
-                    auto *const length = [NSString stringWithFormat:@"%zu", content.size()];
+                    [task.get() didFinish];
+                    tasks->erase(handle);
+                };
 
-                    [headers setObject:mime forKey:@"Content-Type"];
-                    [headers setObject:length forKey:@"Content-Length"];
+                auto resolve = [self, handle, pump, queue = completions](scheme::response response)
+                {
+                    const utils::autorelease_guard guard{};
 
-                    auto *const res = [[[NSHTTPURLResponse alloc] initWithURL:task.get().request.URL
-                                                                   statusCode:response.status
-                                                                  HTTPVersion:nil
-                                                                 headerFields:headers] autorelease];
+                    std::shared_ptr<scheme::stream> stream;
 
-                    [task.get() didReceiveResponse:res];
-                    [task.get() didReceiveData:data];
-                    [task.get() didFinish];
+                    {
+                        auto tasks = self->m_tasks.write();
 
-                    tasks->erase(handle);
+                        if (!tasks->contains(handle))
+                        {
+                            if (response.stream.has_value())
+                            {
+                                response.stream->cancel();
+                            }
+
+                            return;
+                        }
+
+                        auto &entry        = tasks->at(handle);
+                        const auto content = response.data;
+
+                        auto *const headers = [[[NSMutableDictionary<NSString *, NSString *> alloc] init] autorelease];
+
+                        for (const auto &[key, value] : response.headers)
+                        {
+                            [headers setObject:[NSString stringWithUTF8String:value.c_str()]
+                                        forKey:[NSString stringWithUTF8String:key.c_str()]];
+                        }
+
+                        auto *const mime = [NSString stringWithUTF8String:response.mime.c_str()];
+                        [headers setObject:mime forKey:@"Content-Type"];
+
+                        if (!response.stream.has_value())
+                        {
+                            auto *const length = [NSString stringWithFormat:@"%zu", content.size()];
+                            [headers setObject:length forKey:@"Content-Length"];
+                        }
+
+                        auto *const res = [[[NSHTTPURLResponse alloc] initWithURL:entry.task.get().request.URL
+                                                                       statusCode:response.status
+                                                                      HTTPVersion:nil
+                                                                     headerFields:headers] autorelease];
+
+                        [entry.task.get() didReceiveResponse:res];
+
+                        if (!response.stream.has_value())
+                        {
+                            auto *const data = [NSData dataWithBytes:content.data()
+                                                              length:static_cast<NSInteger>(content.size())];
+
+                            [entry.task.get() didReceiveData:data];
+                            [entry.task.get() didFinish];
+
+                            tasks->erase(handle);
+                            return;
+                        }
+
+                        entry.stream = std::make_shared<scheme::stream>(std::move(response.stream.value()));
+                        stream       = entry.stream;
+                    }
+
+                    // The ready callback may run the pump right away, which is why it is only installed once the tasks are
+                    // unlocked again.
+
+                    stream->on_ready([pump, queue]() mutable { queue.push(pump); });
                 };
 
                 auto reject = [self, handle](const scheme::error &error)
@@ -83,7 +143,7 @@ void saucer::scheme::init_objc()
                         return;
                     }
 
-                    auto task = tasks->at(handle);
+                    auto &[task, source] = tasks->at(handle);
 
                     [task.get() didFailWithError:[NSError errorWithDomain:NSURLErrorDomain
                                                                      code:std::to_underlying(error)
@@ -92,10 +152,11 @@ void saucer::scheme::init_objc()
                     tasks->erase(handle);
                 };
 
-                auto &[app, policy, resolver] = self->m_callbacks.at(instance);
+                // Handlers may finish on any thread, completions are funneled back to the main thread and handled in
+                // batches.
 
                 auto req      = scheme::request{{ref}};
-                auto executor = scheme::executor{std::move(resolve), std::move(reject)};
+                auto executor = scheme::executor{completions.wrap(std::move(resolve)), completions.wrap(std::move(reject))};
 
                 if (policy != launch::async)
                 {
@@ -131,6 +192,19 @@ void saucer::scheme::init_objc()
     const saucer::utils::autorelease_guard guard{};
 
     auto tasks = m_tasks.write();
+
+    if (!tasks->contains(urlSchemeTask.hash))
+    {
+        return;
+    }
+
+    // Cancelling the stream releases a producer that may be blocked on it, nothing is going to read from it anymore.
+
+    if (const auto &stream = tasks->at(urlSchemeTask.hash).stream; stream)
+    {
+        stream->cancel();
+    }
+
     tasks->erase(urlSchemeTask.hash);
 }
 @end
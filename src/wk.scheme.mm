@@ -1,8 +1,15 @@
 #include "wk.scheme.impl.hpp"
 
+#include <cctype>
+#include <algorithm>
+
 namespace saucer::scheme
 {
-    request::request(impl data) : m_impl(std::make_unique<impl>(std::move(data))) {}
+    request::request(impl data) : m_impl(std::make_unique<impl>(std::move(data)))
+    {
+        m_impl->url    = m_impl->task.get().request.URL.absoluteString.UTF8String;
+        m_impl->method = m_impl->task.get().request.HTTPMethod.UTF8String;
+    }
 
     request::request(const request &other) : m_impl(std::make_unique<impl>(*other.m_impl)) {}
 
@@ -10,14 +17,54 @@ namespace saucer::scheme
 
     request::~request() = default;
 
+    static bool iequals(std::string_view first, std::string_view second)
+    {
+        auto lower = [](unsigned char c)
+        {
+            return std::tolower(c);
+        };
+
+        return std::ranges::equal(first, second, {}, lower, lower);
+    }
+
+    using header_map = std::map<std::string, std::string>;
+
+    static const header_map &collect(const task_ref &task, std::optional<header_map> &cache)
+    {
+        if (cache.has_value())
+        {
+            return cache.value();
+        }
+
+        auto *const headers = task.get().request.allHTTPHeaderFields;
+        auto &rtn           = cache.emplace();
+
+        [headers enumerateKeysAndObjectsUsingBlock:[&rtn](NSString *key, NSString *value, BOOL *)
+                 {
+                     rtn.emplace(key.UTF8String, value.UTF8String);
+                 }];
+
+        return rtn;
+    }
+
     std::string request::url() const
     {
-        return m_impl->task.get().request.URL.absoluteString.UTF8String;
+        return m_impl->url;
     }
 
     std::string request::method() const
     {
-        return m_impl->task.get().request.HTTPMethod.UTF8String;
+        return m_impl->method;
+    }
+
+    std::string_view request::url_view() const
+    {
+        return m_impl->url;
+    }
+
+    std::string_view request::method_view() const
+    {
+        return m_impl->method;
     }
 
     stash<> request::content() const
@@ -30,20 +77,44 @@ namespace saucer::scheme
         }
 
         const auto *raw = reinterpret_cast<const std::uint8_t *>(body.bytes);
-        return stash<>::from({raw, raw + body.length});
+        auto owner      = std::make_shared<utils::objc_ptr<NSData>>(utils::objc_ptr<NSData>::ref(body));
+
+        return stash<>::share(std::move(owner), {raw, raw + body.length});
     }
 
     std::map<std::string, std::string> request::headers() const
     {
-        auto *const headers = m_impl->task.get().request.allHTTPHeaderFields;
+        return collect(m_impl->task, m_impl->headers);
+    }
 
-        std::map<std::string, std::string> rtn;
+    std::optional<std::string_view> request::header(std::string_view name) const
+    {
+        const auto &headers = collect(m_impl->task, m_impl->headers);
+        const auto it       = std::ranges::find_if(headers, [name](const auto &item) { return iequals(item.first, name); });
 
-        [headers enumerateKeysAndObjectsUsingBlock:[&rtn](NSString *key, NSString *value, BOOL *)
-                 {
-                     rtn.emplace(key.UTF8String, value.UTF8String);
-                 }];
+        if (it == headers.end())
+        {
+            return std::nullopt;
+        }
 
-        return rtn;
+        return it->second;
+    }
+
+    std::optional<stash<>> request::read(std::size_t size) const
+    {
+        auto *const body = m_impl->task.get().request.HTTPBody;
+
+        if (!body || m_impl->offset >= body.length)
+        {
+            return std::nullopt;
+        }
+
+        const auto count = std::min<std::size_t>(size, body.length - m_impl->offset);
+        const auto *raw  = reinterpret_cast<const std::uint8_t *>(body.bytes) + m_impl->offset;
+        auto owner       = std::make_shared<utils::objc_ptr<NSData>>(utils::objc_ptr<NSData>::ref(body));
+
+        m_impl->offset += count;
+
+        return stash<>::share(std::move(owner), {raw, raw + count});
     }
 } // namespace saucer::scheme
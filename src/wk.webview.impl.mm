@@ -76,6 +76,12 @@ namespace saucer
     {
     }
 
+    void webview::impl::run(const std::string &code) const
+    {
+        const utils::autorelease_guard guard{};
+        [web_view.get() evaluateJavaScript:[NSString stringWithUTF8String:code.c_str()] completionHandler:nil];
+    }
+
     std::string webview::impl::inject_script()
     {
         static constexpr auto internal = R"js(
@@ -200,7 +206,7 @@ namespace saucer
                                         return;
                                     }
 
-                                    auto message = std::string{static_cast<NSString *>(body).UTF8String};
+                                    const std::string_view message{static_cast<NSString *>(body).UTF8String};
                                     auto &self   = *handler->m_parent;
 
                                     if (message == "dom_loaded")
@@ -213,7 +219,7 @@ namespace saucer
                                         }
 
                                         self.m_impl->pending.clear();
-                                        self.m_events.at<web_event::dom_ready>().fire();
+                                        self.on_dom_ready();
 
                                         return;
                                     }
@@ -243,7 +249,7 @@ namespace saucer
         class_replaceMethod(
             [NavigationDelegate class], @selector(webView:didFinishNavigation:),
             imp_implementationWithBlock([](NavigationDelegate *delegate, WKWebView *, WKNavigation *)
-                                        { delegate->m_parent->m_events.at<web_event::load>().fire(state::finished); }),
+                                        { delegate->m_parent->on_load(state::finished); }),
             "v@:@");
 
         class_replaceMethod([NavigationDelegate class], @selector(webView:didStartProvisionalNavigation:),
@@ -251,7 +257,7 @@ namespace saucer
                                 [](NavigationDelegate *delegate, WKWebView *, WKNavigation *)
                                 {
                                     delegate->m_parent->m_impl->dom_loaded = false;
-                                    delegate->m_parent->m_events.at<web_event::load>().fire(state::started);
+                                    delegate->m_parent->on_load(state::started);
                                 }),
                             "v@:@");
     }
@@ -1,8 +1,11 @@
 #include "wk.webview.impl.hpp"
 
+#include "scheduler.hpp"
 #include "instantiate.hpp"
+#include "script_batch.hpp"
 #include "cocoa.window.impl.hpp"
 
+#include <utility>
 #include <algorithm>
 
 #include <fmt/core.h>
@@ -23,6 +26,11 @@ namespace saucer
                            register_scheme("saucer");
                        });
 
+        if (prefs.batch_scripts)
+        {
+            m_batch = std::make_shared<utils::script_batch>(m_parent.get(), [this](const auto &code) { m_impl->run(code); });
+        }
+
         const utils::autorelease_guard guard{};
 
         m_impl->config = impl::make_config(prefs);
@@ -376,8 +384,34 @@ namespace saucer
             return m_parent->dispatch([this] { return clear_scripts(); });
         }
 
+        auto scripts = std::exchange(m_impl->scripts, {});
+        std::erase_if(scripts, [](const auto &script) { return !script.permanent; });
+
+        [m_impl->controller removeAllUserScripts];
+        std::ranges::for_each(scripts, [this](const auto &script) { inject(script); });
+    }
+
+    void webview::uninject(const script &script)
+    {
+        const utils::autorelease_guard guard{};
+
+        if (!m_parent->thread_safe())
+        {
+            return m_parent->dispatch([this, script] { return uninject(script); });
+        }
+
+        // User scripts can only be removed all at once, which is why the remaining ones are added back afterwards.
+
+        auto scripts  = std::exchange(m_impl->scripts, {});
+        const auto it = std::ranges::find(scripts, script);
+
+        if (it != scripts.end())
+        {
+            scripts.erase(it);
+        }
+
         [m_impl->controller removeAllUserScripts];
-        std::ranges::for_each(m_impl->permanent_scripts, [this](const auto &script) { inject(script); });
+        std::ranges::for_each(scripts, [this](const auto &remaining) { inject(remaining); });
     }
 
     void webview::inject(const script &script)
@@ -398,18 +432,7 @@ namespace saucer
                                                        forMainFrameOnly:main_only] autorelease];
 
         [m_impl->controller addUserScript:user_script];
-
-        if (!script.permanent)
-        {
-            return;
-        }
-
-        if (std::ranges::find(m_impl->permanent_scripts, script) != m_impl->permanent_scripts.end())
-        {
-            return;
-        }
-
-        m_impl->permanent_scripts.emplace_back(script);
+        m_impl->scripts.emplace_back(script);
     }
 
     void webview::execute(const std::string &code)
@@ -427,7 +450,12 @@ namespace saucer
             return;
         }
 
-        [m_impl->web_view.get() evaluateJavaScript:[NSString stringWithUTF8String:code.c_str()] completionHandler:nil];
+        if (!m_batch)
+        {
+            return m_impl->run(code);
+        }
+
+        m_batch->push(code);
     }
 
     void webview::handle_scheme(const std::string &name, scheme::resolver &&resolver, launch policy)
@@ -443,8 +471,14 @@ namespace saucer
             return;
         }
 
-        [impl::schemes[name].get() add_callback:{.app = m_parent.get(), .policy = policy, .resolver = std::move(resolver)}
-                                        webview:m_impl->web_view.get()];
+        auto callback = scheme::callback{
+            .app         = m_parent.get(),
+            .policy      = policy,
+            .resolver    = std::move(resolver),
+            .completions = utils::completion_queue{m_parent.get()},
+        };
+
+        [impl::schemes[name].get() add_callback:std::move(callback) webview:m_impl->web_view.get()];
     }
 
     void webview::remove_scheme(const std::string &name)
@@ -454,6 +488,11 @@ namespace saucer
             return m_parent->dispatch([this, name] { return remove_scheme(name); });
         }
 
+        if (m_scheduler)
+        {
+            m_scheduler->remove(name);
+        }
+
         [impl::schemes[name].get() del_callback:m_impl->web_view.get()];
     }
 
@@ -1,8 +1,16 @@
 #include "wkg.scheme.impl.hpp"
 
+#include <array>
+#include <vector>
+#include <algorithm>
+
 namespace saucer::scheme
 {
-    request::request(impl data) : m_impl(std::make_unique<impl>(std::move(data))) {}
+    request::request(impl data) : m_impl(std::make_unique<impl>(std::move(data)))
+    {
+        m_impl->url    = webkit_uri_scheme_request_get_uri(m_impl->request.get());
+        m_impl->method = webkit_uri_scheme_request_get_http_method(m_impl->request.get());
+    }
 
     request::request(const request &other) : m_impl(std::make_unique<impl>(*other.m_impl)) {}
 
@@ -12,12 +20,44 @@ namespace saucer::scheme
 
     std::string request::url() const
     {
-        return webkit_uri_scheme_request_get_uri(m_impl->request.get());
+        return m_impl->url;
     }
 
     std::string request::method() const
     {
-        return webkit_uri_scheme_request_get_http_method(m_impl->request.get());
+        return m_impl->method;
+    }
+
+    std::string_view request::url_view() const
+    {
+        return m_impl->url;
+    }
+
+    std::string_view request::method_view() const
+    {
+        return m_impl->method;
+    }
+
+    static std::optional<stash<>> read_bytes(GInputStream *stream, std::size_t size)
+    {
+        auto *const raw = g_input_stream_read_bytes(stream, size, nullptr, nullptr);
+
+        if (!raw)
+        {
+            return std::nullopt;
+        }
+
+        auto bytes = std::shared_ptr<GBytes>{raw, g_bytes_unref};
+
+        gsize length{};
+        const auto *data = reinterpret_cast<const std::uint8_t *>(g_bytes_get_data(bytes.get(), &length));
+
+        if (length == 0)
+        {
+            return std::nullopt;
+        }
+
+        return stash<>::share(std::move(bytes), {data, data + length});
     }
 
     stash<> request::content() const
@@ -29,17 +69,24 @@ namespace saucer::scheme
             return stash<>::empty();
         }
 
-        auto content = utils::g_bytes_ptr{g_input_stream_read_bytes(stream.get(), G_MAXSSIZE, nullptr, nullptr)};
+        std::vector<std::uint8_t> rtn;
 
-        if (!content)
+        while (auto chunk = read_bytes(stream.get(), 64uz * 1024))
         {
-            return stash<>::empty();
+            rtn.insert(rtn.end(), chunk->data(), chunk->data() + chunk->size());
         }
 
-        gsize size{};
-        const auto *data = reinterpret_cast<const std::uint8_t *>(g_bytes_get_data(content.get(), &size));
+        return stash<>::from(std::move(rtn));
+    }
+
+    std::optional<stash<>> request::read(std::size_t size) const
+    {
+        if (!m_impl->body)
+        {
+            return std::nullopt;
+        }
 
-        return stash<>::from({data, data + size});
+        return read_bytes(m_impl->body.get(), size);
     }
 
     std::map<std::string, std::string> request::headers() const
@@ -54,4 +101,28 @@ namespace saucer::scheme
 
         return rtn;
     }
+
+    std::optional<std::string_view> request::header(std::string_view name) const
+    {
+        auto *const headers = webkit_uri_scheme_request_get_http_headers(m_impl->request.get());
+
+        // Soup expects a null-terminated name, we copy it into a small buffer to avoid allocating a string.
+        std::array<char, 128> key{};
+
+        if (!headers || name.size() >= key.size())
+        {
+            return std::nullopt;
+        }
+
+        std::ranges::copy(name, key.begin());
+
+        const auto *value = soup_message_headers_get_list(headers, key.data());
+
+        if (!value)
+        {
+            return std::nullopt;
+        }
+
+        return value;
+    }
 } // namespace saucer::scheme
@@ -2,10 +2,214 @@
 
 #include "handle.hpp"
 
+#include <cstring>
+#include <algorithm>
+
 #include <rebind/utils/enum.hpp>
 
+struct SaucerStreamInput
+{
+    GInputStream parent;
+
+  public:
+    saucer::scheme::stream_state *state;
+};
+
+struct SaucerStreamInputClass
+{
+    GInputStreamClass parent;
+};
+
+struct SaucerStreamTrigger
+{
+    GSource parent;
+
+  public:
+    std::shared_ptr<lockpp::lock<std::vector<GSource *>>> *waiting;
+};
+
+static void saucer_stream_input_pollable_init(GPollableInputStreamInterface *);
+
+G_DEFINE_TYPE_WITH_CODE(SaucerStreamInput, saucer_stream_input, G_TYPE_INPUT_STREAM,
+                        G_IMPLEMENT_INTERFACE(G_TYPE_POLLABLE_INPUT_STREAM, saucer_stream_input_pollable_init))
+
+static bool saucer_stream_input_fill(saucer::scheme::stream_state &state)
+{
+    auto &[source, pending, offset, waiting] = state;
+
+    if (pending.has_value() && offset < pending->size())
+    {
+        return true;
+    }
+
+    pending = source.poll();
+    offset  = 0;
+
+    return pending.has_value() || source.finished();
+}
+
+static gssize saucer_stream_input_copy(saucer::scheme::stream_state &state, void *buffer, gsize count)
+{
+    auto &[source, pending, offset, waiting] = state;
+    const auto size                          = std::min(count, pending->size() - offset);
+
+    std::memcpy(buffer, pending->data() + offset, size);
+    offset += size;
+
+    return static_cast<gssize>(size);
+}
+
+static gssize saucer_stream_input_read(GInputStream *stream, void *buffer, gsize count, GCancellable *, GError **)
+{
+    auto &state                              = *reinterpret_cast<SaucerStreamInput *>(stream)->state;
+    auto &[source, pending, offset, waiting] = state;
+
+    while (!pending.has_value() || offset >= pending->size())
+    {
+        pending = source.read();
+        offset  = 0;
+
+        if (!pending.has_value())
+        {
+            return 0;
+        }
+    }
+
+    return saucer_stream_input_copy(state, buffer, count);
+}
+
+static gssize saucer_stream_input_read_nonblocking(GPollableInputStream *stream, void *buffer, gsize count,
+                                                   GError **error)
+{
+    auto &state = *reinterpret_cast<SaucerStreamInput *>(stream)->state;
+
+    while (!state.pending.has_value() || state.offset >= state.pending->size())
+    {
+        if (!saucer_stream_input_fill(state))
+        {
+            g_set_error_literal(error, G_IO_ERROR, G_IO_ERROR_WOULD_BLOCK, "No data available yet");
+            return -1;
+        }
+
+        if (!state.pending.has_value())
+        {
+            return 0;
+        }
+    }
+
+    return saucer_stream_input_copy(state, buffer, count);
+}
+
+static gboolean saucer_stream_input_is_readable(GPollableInputStream *stream)
+{
+    return saucer_stream_input_fill(*reinterpret_cast<SaucerStreamInput *>(stream)->state);
+}
+
+static gboolean saucer_stream_trigger_dispatch(GSource *source, GSourceFunc, gpointer)
+{
+    g_source_set_ready_time(source, -1);
+    return G_SOURCE_CONTINUE;
+}
+
+static void saucer_stream_trigger_finalize(GSource *source)
+{
+    auto *const trigger = reinterpret_cast<SaucerStreamTrigger *>(source);
+
+    std::erase((*trigger->waiting)->write().value(), source);
+    delete trigger->waiting;
+}
+
+static GSourceFuncs saucer_stream_trigger_funcs = {
+    .prepare  = nullptr,
+    .check    = nullptr,
+    .dispatch = saucer_stream_trigger_dispatch,
+    .finalize = saucer_stream_trigger_finalize,
+};
+
+static GSource *saucer_stream_input_create_source(GPollableInputStream *stream, GCancellable *cancellable)
+{
+    auto &state = *reinterpret_cast<SaucerStreamInput *>(stream)->state;
+
+    auto *const trigger = g_source_new(&saucer_stream_trigger_funcs, sizeof(SaucerStreamTrigger));
+    reinterpret_cast<SaucerStreamTrigger *>(trigger)->waiting = new std::shared_ptr{state.waiting};
+
+    state.waiting->write()->emplace_back(trigger);
+
+    // The producer might have written (or closed the stream) before the trigger was registered, in which case its wakeup
+    // is lost and we have to fire right away.
+
+    if (saucer_stream_input_fill(state))
+    {
+        g_source_set_ready_time(trigger, 0);
+    }
+
+    auto *const rtn = g_pollable_source_new_full(stream, trigger, cancellable);
+    g_source_unref(trigger);
+
+    return rtn;
+}
+
+static gboolean saucer_stream_input_close(GInputStream *stream, GCancellable *, GError **)
+{
+    reinterpret_cast<SaucerStreamInput *>(stream)->state->source.cancel();
+    return TRUE;
+}
+
+static void saucer_stream_input_finalize(GObject *object)
+{
+    auto *const state = reinterpret_cast<SaucerStreamInput *>(object)->state;
+
+    state->source.cancel();
+    delete state;
+
+    G_OBJECT_CLASS(saucer_stream_input_parent_class)->finalize(object);
+}
+
+static void saucer_stream_input_class_init(SaucerStreamInputClass *klass)
+{
+    G_OBJECT_CLASS(klass)->finalize       = saucer_stream_input_finalize;
+    G_INPUT_STREAM_CLASS(klass)->read_fn  = saucer_stream_input_read;
+    G_INPUT_STREAM_CLASS(klass)->close_fn = saucer_stream_input_close;
+}
+
+static void saucer_stream_input_pollable_init(GPollableInputStreamInterface *iface)
+{
+    iface->is_readable      = saucer_stream_input_is_readable;
+    iface->create_source    = saucer_stream_input_create_source;
+    iface->read_nonblocking = saucer_stream_input_read_nonblocking;
+}
+
+static void saucer_stream_input_init(SaucerStreamInput *) {}
+
 namespace saucer::scheme
 {
+    static utils::g_object_ptr<GInputStream> make_input(scheme::stream source)
+    {
+        auto *const input = reinterpret_cast<SaucerStreamInput *>(g_object_new(saucer_stream_input_get_type(), nullptr));
+        auto waiting      = std::make_shared<lockpp::lock<std::vector<GSource *>>>();
+
+        // GIO reads the stream asynchronously by polling it, the producer thus only has to wake up whoever is waiting
+        // instead of a GIO worker thread being parked on the stream. The callback must not hold on to the stream itself.
+
+        source.on_ready(
+            [waiting]
+            {
+                for (auto *const trigger : waiting->write().value())
+                {
+                    g_source_set_ready_time(trigger, 0);
+                }
+            });
+
+        input->state = new stream_state{
+            .source  = std::move(source),
+            .pending = std::nullopt,
+            .offset  = 0,
+            .waiting = std::move(waiting),
+        };
+
+        return utils::g_object_ptr<GInputStream>{G_INPUT_STREAM(input)};
+    }
+
     void handler::add_callback(WebKitWebView *id, callback callback)
     {
         m_callbacks.emplace(id, std::move(callback));
@@ -26,13 +230,30 @@ namespace saucer::scheme
             return;
         }
 
-        auto resolve = [request](const scheme::response &response)
+        auto resolve = [request](scheme::response response)
         {
-            const auto data = response.data;
-            const auto size = static_cast<gssize>(data.size());
+            auto release = [](stash<> *data)
+            {
+                delete data;
+            };
 
-            auto bytes  = utils::g_bytes_ptr{g_bytes_new(data.data(), size)};
-            auto stream = utils::g_object_ptr<GInputStream>{g_memory_input_stream_new_from_bytes(bytes.get())};
+            auto stream = utils::g_object_ptr<GInputStream>{};
+            auto size   = gssize{-1};
+
+            if (response.stream.has_value())
+            {
+                stream = make_input(std::move(response.stream.value()));
+            }
+            else
+            {
+                auto *const data = new stash<>{std::move(response.data)};
+                size             = static_cast<gssize>(data->size());
+
+                auto bytes = utils::g_bytes_ptr{
+                    g_bytes_new_with_free_func(data->data(), size, reinterpret_cast<GDestroyNotify>(+release), data)};
+
+                stream = utils::g_object_ptr<GInputStream>{g_memory_input_stream_new_from_bytes(bytes.get())};
+            }
 
             auto res = utils::g_object_ptr<WebKitURISchemeResponse>{webkit_uri_scheme_response_new(stream.get(), size)};
             auto *const headers = soup_message_headers_new(SOUP_MESSAGE_HEADERS_RESPONSE);
@@ -60,10 +281,13 @@ namespace saucer::scheme
             webkit_uri_scheme_request_finish_error(request.get(), err.get());
         };
 
-        auto &[app, policy, resolver] = state->m_callbacks.at(identifier);
+        auto &[app, policy, resolver, completions] = state->m_callbacks.at(identifier);
+
+        // Handlers may finish on any thread, completions are funneled back to the main loop and handled in batches.
 
-        auto executor = scheme::executor{std::move(resolve), std::move(reject)};
-        auto req      = scheme::request{{request}};
+        auto executor = scheme::executor{completions.wrap(std::move(resolve)), completions.wrap(std::move(reject))};
+        auto body     = utils::g_object_ptr<GInputStream>{webkit_uri_scheme_request_get_http_body(request.get())};
+        auto req      = scheme::request{{request, std::move(body)}};
 
         if (policy != launch::async)
         {
@@ -5,7 +5,11 @@
 #include "wkg.scheme.impl.hpp"
 
 #include "handle.hpp"
+#include "scheduler.hpp"
 #include "instantiate.hpp"
+#include "script_batch.hpp"
+
+#include <algorithm>
 
 #include <fmt/core.h>
 
@@ -16,6 +20,11 @@ namespace saucer
         static std::once_flag flag;
         std::call_once(flag, [] { register_scheme("saucer"); });
 
+        if (prefs.batch_scripts)
+        {
+            m_batch = std::make_shared<utils::script_batch>(m_parent.get(), [this](const auto &code) { m_impl->run(code); });
+        }
+
         m_impl->web_view = WEBKIT_WEB_VIEW(webkit_web_view_new());
         m_impl->settings = impl::make_settings(prefs);
 
@@ -65,8 +74,35 @@ namespace saucer
 
         auto on_message = [](WebKitWebView *, JSCValue *value, void *data)
         {
-            auto message = std::string{utils::handle<char *, g_free>{jsc_value_to_string(value)}.get()};
-            auto &self   = *reinterpret_cast<webview *>(data);
+            auto &self = *reinterpret_cast<webview *>(data);
+
+            if (jsc_value_is_array_buffer(value))
+            {
+                gsize size{};
+                auto *const buffer = reinterpret_cast<const std::uint8_t *>(jsc_value_array_buffer_get_data(value, &size));
+
+                // The value keeps the array-buffer alive, we thus hold on to it instead of copying the buffer. As it belongs
+                // to the javascript context, it is only ever released on the main thread.
+
+                auto release = [](const void *value)
+                {
+                    auto unref = [](gpointer value) -> gboolean
+                    {
+                        g_object_unref(value);
+                        return G_SOURCE_REMOVE;
+                    };
+
+                    g_main_context_invoke(nullptr, +unref, const_cast<void *>(value));
+                };
+
+                auto owner = std::shared_ptr<const void>{g_object_ref(value), release};
+                self.on_binary(stash<>::share(std::move(owner), {buffer, size}));
+
+                return;
+            }
+
+            const utils::handle<char *, g_free> raw{jsc_value_to_string(value)};
+            const std::string_view message{raw.get()};
 
             if (message == "dom_loaded")
             {
@@ -78,7 +114,7 @@ namespace saucer
                 }
 
                 self.m_impl->pending.clear();
-                self.m_events.at<web_event::dom_ready>().fire();
+                self.on_dom_ready();
 
                 return;
             }
@@ -100,7 +136,7 @@ namespace saucer
 
             if (event == WEBKIT_LOAD_FINISHED)
             {
-                self->m_events.at<web_event::load>().fire(state::finished);
+                self->on_load(state::finished);
                 return;
             }
 
@@ -110,7 +146,7 @@ namespace saucer
             }
 
             self->m_impl->dom_loaded = false;
-            self->m_events.at<web_event::load>().fire(state::started);
+            self->on_load(state::started);
         };
 
         g_signal_connect(m_impl->web_view, "load-changed", G_CALLBACK(+on_load), this);
@@ -370,19 +406,38 @@ namespace saucer
 
         for (auto it = m_impl->scripts.begin(); it != m_impl->scripts.end();)
         {
-            const auto &[script, permanent] = *it;
+            const auto &[user_script, script] = *it;
 
-            if (permanent)
+            if (script.permanent)
             {
                 ++it;
                 continue;
             }
 
-            webkit_user_content_manager_remove_script(manager, script.get());
+            webkit_user_content_manager_remove_script(manager, user_script.get());
             it = m_impl->scripts.erase(it);
         }
     }
 
+    void webview::uninject(const script &script)
+    {
+        if (!m_parent->thread_safe())
+        {
+            return m_parent->dispatch([this, script] { return uninject(script); });
+        }
+
+        auto *const manager = webkit_web_view_get_user_content_manager(m_impl->web_view);
+        const auto it       = std::ranges::find(m_impl->scripts, script, [](const auto &entry) { return entry.second; });
+
+        if (it == m_impl->scripts.end())
+        {
+            return;
+        }
+
+        webkit_user_content_manager_remove_script(manager, it->first.get());
+        m_impl->scripts.erase(it);
+    }
+
     void webview::inject(const script &script)
     {
         if (!m_parent->thread_safe())
@@ -398,7 +453,7 @@ namespace saucer
         auto *const manager     = webkit_web_view_get_user_content_manager(m_impl->web_view);
         auto *const user_script = webkit_user_script_new(script.code.c_str(), frame, time, nullptr, nullptr);
 
-        m_impl->scripts.emplace_back(user_script, script.permanent);
+        m_impl->scripts.emplace_back(user_script, script);
         webkit_user_content_manager_add_script(manager, user_script);
     }
 
@@ -415,7 +470,12 @@ namespace saucer
             return;
         }
 
-        webkit_web_view_evaluate_javascript(m_impl->web_view, code.c_str(), -1, nullptr, nullptr, nullptr, nullptr, nullptr);
+        if (!m_batch)
+        {
+            return m_impl->run(code);
+        }
+
+        m_batch->push(code);
     }
 
     void webview::handle_scheme(const std::string &name, scheme::resolver &&resolver, launch policy)
@@ -431,8 +491,14 @@ namespace saucer
             return;
         }
 
-        impl::schemes[name]->add_callback(m_impl->web_view,
-                                          {.app = m_parent.get(), .policy = policy, .resolver = std::move(resolver)});
+        auto callback = scheme::callback{
+            .app         = m_parent.get(),
+            .policy      = policy,
+            .resolver    = std::move(resolver),
+            .completions = utils::completion_queue{m_parent.get()},
+        };
+
+        impl::schemes[name]->add_callback(m_impl->web_view, std::move(callback));
     }
 
     void webview::remove_scheme(const std::string &name)
@@ -442,6 +508,11 @@ namespace saucer
             return m_parent->dispatch([this, name] { return remove_scheme(name); });
         }
 
+        if (m_scheduler)
+        {
+            m_scheduler->remove(name);
+        }
+
         if (!impl::schemes.contains(name))
         {
             return;
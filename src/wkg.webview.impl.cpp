@@ -106,12 +106,21 @@ namespace saucer
     {
     }
 
+    void webview::impl::run(const std::string &code) const
+    {
+        webkit_web_view_evaluate_javascript(web_view, code.c_str(), -1, nullptr, nullptr, nullptr, nullptr, nullptr);
+    }
+
     std::string webview::impl::inject_script()
     {
         static constexpr auto internal = R"js(
             message: async (message) =>
             {
                 window.webkit.messageHandlers.saucer.postMessage(message);
+            },
+            binary: async (frame) =>
+            {
+                window.webkit.messageHandlers.saucer.postMessage(frame.buffer);
             }
         )js";
 
@@ -2,9 +2,21 @@
 
 #include "win32.utils.hpp"
 
+#include <cctype>
+#include <algorithm>
+
 namespace saucer::scheme
 {
-    request::request(impl data) : m_impl(std::make_unique<impl>(std::move(data))) {}
+    request::request(impl data) : m_impl(std::make_unique<impl>(std::move(data)))
+    {
+        utils::string_handle raw;
+
+        m_impl->request->get_Uri(&raw.reset());
+        m_impl->url = utils::narrow(raw.get());
+
+        m_impl->request->get_Method(&raw.reset());
+        m_impl->method = utils::narrow(raw.get());
+    }
 
     request::request(const request &other) : m_impl(std::make_unique<impl>(*other.m_impl)) {}
 
@@ -12,41 +24,32 @@ namespace saucer::scheme
 
     request::~request() = default;
 
-    std::string request::url() const
+    static bool iequals(std::string_view first, std::string_view second)
     {
-        utils::string_handle raw;
-        m_impl->request->get_Uri(&raw.reset());
+        auto lower = [](unsigned char c)
+        {
+            return std::tolower(c);
+        };
 
-        return utils::narrow(raw.get());
+        return std::ranges::equal(first, second, {}, lower, lower);
     }
 
-    std::string request::method() const
-    {
-        utils::string_handle raw;
-        m_impl->request->get_Method(&raw.reset());
-
-        return utils::narrow(raw.get());
-    }
+    using header_map = std::map<std::string, std::string>;
 
-    stash<> request::content() const
+    static const header_map &collect(ICoreWebView2WebResourceRequest *request, std::optional<header_map> &cache)
     {
-        if (!m_impl->body)
+        if (cache.has_value())
         {
-            return stash<>::empty();
+            return cache.value();
         }
 
-        return stash<>::from(utils::read(m_impl->body.Get()));
-    }
-
-    std::map<std::string, std::string> request::headers() const
-    {
         ComPtr<ICoreWebView2HttpRequestHeaders> headers;
-        m_impl->request->get_Headers(&headers);
+        request->get_Headers(&headers);
 
         ComPtr<ICoreWebView2HttpHeadersCollectionIterator> it;
         headers->GetIterator(&it);
 
-        std::map<std::string, std::string> rtn;
+        auto &rtn = cache.emplace();
         BOOL has_header{};
 
         while ((it->get_HasCurrentHeader(&has_header), has_header))
@@ -63,4 +66,72 @@ namespace saucer::scheme
 
         return rtn;
     }
+
+    std::string request::url() const
+    {
+        return m_impl->url;
+    }
+
+    std::string request::method() const
+    {
+        return m_impl->method;
+    }
+
+    std::string_view request::url_view() const
+    {
+        return m_impl->url;
+    }
+
+    std::string_view request::method_view() const
+    {
+        return m_impl->method;
+    }
+
+    stash<> request::content() const
+    {
+        if (!m_impl->body)
+        {
+            return stash<>::empty();
+        }
+
+        return stash<>::from(utils::read(m_impl->body.Get()));
+    }
+
+    std::map<std::string, std::string> request::headers() const
+    {
+        return collect(m_impl->request.Get(), m_impl->headers);
+    }
+
+    std::optional<std::string_view> request::header(std::string_view name) const
+    {
+        const auto &headers = collect(m_impl->request.Get(), m_impl->headers);
+        const auto it       = std::ranges::find_if(headers, [name](const auto &item) { return iequals(item.first, name); });
+
+        if (it == headers.end())
+        {
+            return std::nullopt;
+        }
+
+        return it->second;
+    }
+
+    std::optional<stash<>> request::read(std::size_t size) const
+    {
+        if (!m_impl->body)
+        {
+            return std::nullopt;
+        }
+
+        std::vector<std::uint8_t> rtn(size);
+        ULONG read{};
+
+        if (!SUCCEEDED(m_impl->body->Read(rtn.data(), static_cast<ULONG>(rtn.size()), &read)) || read == 0)
+        {
+            return std::nullopt;
+        }
+
+        rtn.resize(read);
+
+        return stash<>::from(std::move(rtn));
+    }
 } // namespace saucer::scheme
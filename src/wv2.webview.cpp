@@ -1,6 +1,8 @@
 #include "wv2.webview.impl.hpp"
 
+#include "scheduler.hpp"
 #include "instantiate.hpp"
+#include "script_batch.hpp"
 #include "win32.utils.hpp"
 
 #include "win32.app.impl.hpp"
@@ -9,6 +11,7 @@
 #include "wv2.navigation.impl.hpp"
 
 #include <ranges>
+#include <algorithm>
 #include <cassert>
 #include <filesystem>
 
@@ -25,6 +28,11 @@ namespace saucer
         static std::once_flag flag;
         std::call_once(flag, [] { register_scheme("saucer"); });
 
+        if (prefs.batch_scripts)
+        {
+            m_batch = std::make_shared<utils::script_batch>(m_parent.get(), [this](const auto &code) { m_impl->run(code); });
+        }
+
         m_impl->o_wnd_proc = utils::overwrite_wndproc(window::m_impl->hwnd.get(), impl::wnd_proc);
         m_impl->create_webview(m_parent, window::m_impl->hwnd.get(), prefs);
 
@@ -87,7 +95,7 @@ namespace saucer
         auto navigation_starting = [this](auto, ICoreWebView2NavigationStartingEventArgs *args)
         {
             m_impl->dom_loaded = false;
-            m_parent->post([this] { m_events.at<web_event::load>().fire(state::started); });
+            m_parent->post([this] { on_load(state::started); });
 
             auto request = navigation{{args}};
 
@@ -121,7 +129,7 @@ namespace saucer
             }
 
             m_impl->pending.clear();
-            m_parent->post([this] { m_events.at<web_event::dom_ready>().fire(); });
+            m_parent->post([this] { on_dom_ready(); });
 
             return S_OK;
         };
@@ -429,6 +437,28 @@ namespace saucer
         }
     }
 
+    void webview::uninject(const script &script)
+    {
+        if (!m_parent->thread_safe())
+        {
+            return m_parent->dispatch([this, script] { return uninject(script); });
+        }
+
+        auto it = std::ranges::find(m_impl->scripts, script, [](const auto &entry) { return entry.first; });
+
+        if (it == m_impl->scripts.end())
+        {
+            return;
+        }
+
+        if (!it->second.empty())
+        {
+            m_impl->web_view->RemoveScriptToExecuteOnDocumentCreated(it->second.c_str());
+        }
+
+        m_impl->scripts.erase(it);
+    }
+
     void webview::inject(const script &script)
     {
         if (!m_parent->thread_safe())
@@ -436,15 +466,30 @@ namespace saucer
             return m_parent->dispatch([this, script] { return inject(script); });
         }
 
+        m_impl->scripts.emplace_back(script, L"");
+
         if (script.time == load_time::ready)
         {
-            m_impl->scripts.emplace_back(script, L"");
             return;
         }
 
+        // The id is only known once the script was added, by then the script might already have been removed again, in
+        // which case it is removed from the webview right away.
+
         auto callback = [this, script](auto, LPCWSTR id)
         {
-            m_impl->scripts.emplace_back(script, id);
+            auto pending = [&script](const auto &entry)
+            {
+                return entry.second.empty() && entry.first == script;
+            };
+
+            if (auto it = std::ranges::find_if(m_impl->scripts, pending); it != m_impl->scripts.end())
+            {
+                it->second = id;
+                return S_OK;
+            }
+
+            m_impl->web_view->RemoveScriptToExecuteOnDocumentCreated(id);
             return S_OK;
         };
 
@@ -478,7 +523,12 @@ namespace saucer
             return;
         }
 
-        m_impl->web_view->ExecuteScript(utils::widen(code).c_str(), nullptr);
+        if (!m_batch)
+        {
+            return m_impl->run(code);
+        }
+
+        m_batch->push(code);
     }
 
     void webview::handle_scheme(const std::string &name, scheme::resolver &&resolver, launch policy)
@@ -516,6 +566,11 @@ namespace saucer
             return m_parent->dispatch([this, name] { return remove_scheme(name); });
         }
 
+        if (m_scheduler)
+        {
+            m_scheduler->remove(name);
+        }
+
         ComPtr<ICoreWebView2_22> webview;
 
         if (!SUCCEEDED(m_impl->web_view.As(&webview)))
@@ -22,6 +22,11 @@
 
 namespace saucer
 {
+    void webview::impl::run(const std::string &code) const
+    {
+        web_view->ExecuteScript(utils::widen(code).c_str(), nullptr);
+    }
+
     std::string webview::impl::inject_script()
     {
         static constexpr auto internal = R"js(
@@ -189,7 +194,7 @@ namespace saucer
             return S_OK;
         }
 
-        auto resolve = [environment, args, deferral](const scheme::response &response)
+        auto resolve = [environment, args, deferral](scheme::response response)
         {
             const auto *raw = reinterpret_cast<const BYTE *>(response.data.data());
             const auto size = static_cast<const UINT>(response.data.size());
@@ -232,10 +237,54 @@ namespace saucer
             };
         };
 
+        // WebView2 requires the whole body as an `IStream` up-front, streamed responses are thus collected first.
+
+        auto buffered = []<typename T>(T &&callback)
+        {
+            return [callback = std::forward<T>(callback)](scheme::response response) mutable
+            {
+                if (!response.stream.has_value())
+                {
+                    return std::invoke(callback, std::move(response));
+                }
+
+                struct state
+                {
+                    bool done{false};
+                    scheme::response response;
+                    std::vector<std::uint8_t> collected;
+                };
+
+                auto source  = std::move(response.stream.value());
+                auto pending = std::make_shared<state>();
+
+                response.stream.reset();
+                pending->response = std::move(response);
+
+                source.on_ready(
+                    [source, pending, callback]() mutable
+                    {
+                        while (auto chunk = source.poll())
+                        {
+                            pending->collected.insert(pending->collected.end(), chunk->data(),
+                                                      chunk->data() + chunk->size());
+                        }
+
+                        if (!source.finished() || std::exchange(pending->done, true))
+                        {
+                            return;
+                        }
+
+                        pending->response.data = stash<>::from(std::move(pending->collected));
+                        std::invoke(callback, std::move(pending->response));
+                    });
+            };
+        };
+
         auto &[resolver, policy] = scheme->second;
 
         auto req      = scheme::request{{request, content}};
-        auto executor = scheme::executor{forward(std::move(resolve)), forward(std::move(reject))};
+        auto executor = scheme::executor{buffered(forward(std::move(resolve))), forward(std::move(reject))};
 
         if (policy != launch::async)
         {
@@ -347,7 +396,7 @@ namespace saucer
 
         auto handler = [self](auto...)
         {
-            self->m_parent->post([self] { self->m_events.at<web_event::load>().fire(state::finished); });
+            self->m_parent->post([self] { self->on_load(state::finished); });
             return S_OK;
         };
 
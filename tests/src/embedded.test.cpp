@@ -0,0 +1,39 @@
+#include <boost/ut.hpp>
+#include <saucer/embedded.hpp>
+
+using namespace boost::ut;
+
+suite<"embedded"> embedded_suite = []
+{
+    static constexpr std::array<std::uint8_t, 3> content{1, 2, 3};
+
+    static constexpr saucer::asset_table table{std::array{
+        saucer::embedded_asset{.name = "index.html", .content = content, .mime = "text/html"},
+        saucer::embedded_asset{.name = "index.js", .content = content, .mime = "application/javascript"},
+        saucer::embedded_asset{.name = "style.css", .content = content, .mime = "text/css", .etag = R"("abc")"},
+        saucer::embedded_asset{.name = "assets/logo.png", .content = content, .mime = "image/png"},
+    }};
+
+    "lookup"_test = []
+    {
+        static constexpr saucer::embedded_assets assets = table;
+        static constexpr saucer::embedded_assets empty  = saucer::asset_table<0>{{}};
+
+        static_assert(assets.find("index.js") != nullptr);
+        static_assert(assets.find("index.js")->mime == "application/javascript");
+
+        for (const auto *name : {"index.html", "index.js", "style.css", "assets/logo.png"})
+        {
+            const auto *asset = assets.find(name);
+
+            expect(asset != nullptr);
+            expect(asset->name == name);
+        }
+
+        expect(assets.find("style.css")->etag == R"("abc")");
+
+        expect(assets.find("") == nullptr);
+        expect(assets.find("missing.html") == nullptr);
+        expect(empty.find("index.html") == nullptr);
+    };
+};
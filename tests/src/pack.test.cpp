@@ -0,0 +1,71 @@
+#include <boost/ut.hpp>
+#include <saucer/pack.hpp>
+
+#include <cstdint>
+#include <fstream>
+
+using namespace boost::ut;
+namespace fs = std::filesystem;
+
+suite<"pack"> pack_suite = []
+{
+    "roundtrip"_test = []
+    {
+        const auto root   = fs::temp_directory_path() / "saucer-pack-test";
+        const auto output = root / "assets.pack";
+
+        fs::remove_all(root);
+        fs::create_directories(root / "content" / "nested");
+
+        std::ofstream{root / "content" / "index.html"} << "<html></html>";
+        std::ofstream{root / "content" / "nested" / "app.js"} << "console.log(1);";
+
+        expect(saucer::asset_pack::create(root / "content", output));
+
+        const auto pack = saucer::asset_pack::open(output);
+        expect(fatal(pack.has_value()));
+
+        expect(pack->size() == 2);
+        expect(!pack->find("missing.txt").has_value());
+
+        const auto file = pack->find("nested/app.js");
+        expect(fatal(file.has_value()));
+
+        const auto content = std::string_view{reinterpret_cast<const char *>(file->content.data()), file->content.size()};
+
+        expect(file->mime == "application/javascript");
+        expect(content == "console.log(1);");
+        expect(reinterpret_cast<std::uintptr_t>(file->content.data()) % 16 == 0);
+
+        expect(!saucer::asset_pack::open(root / "content" / "index.html").has_value());
+
+        fs::remove_all(root);
+    };
+
+    "unknown-encoding"_test = []
+    {
+        const auto root   = fs::temp_directory_path() / "saucer-pack-encoding";
+        const auto output = root / "assets.pack";
+
+        fs::remove_all(root);
+        fs::create_directories(root / "content");
+
+        std::ofstream{root / "content" / "index.html"} << "<html></html>";
+
+        expect(fatal(saucer::asset_pack::create(root / "content", output)));
+        expect(saucer::asset_pack::open(output).has_value());
+
+        // The encoding is the last byte of the first entry, which directly follows the 24 byte header.
+
+        {
+            std::fstream stream{output, std::ios::binary | std::ios::in | std::ios::out};
+
+            stream.seekp(24 + 47);
+            stream.put(static_cast<char>(0x7F));
+        }
+
+        expect(!saucer::asset_pack::open(output).has_value());
+
+        fs::remove_all(root);
+    };
+};
@@ -0,0 +1,102 @@
+#include <boost/ut.hpp>
+#include <saucer/webview.hpp>
+
+#include <thread>
+
+using namespace boost::ut;
+
+suite<"scheme"> scheme_suite = []
+{
+    "stream"_test = []
+    {
+        saucer::scheme::stream stream{8};
+
+        std::thread producer{[stream]() mutable
+                             {
+                                 for (auto i = 0; 100 > i; ++i)
+                                 {
+                                     stream.write(saucer::stash<>::from({1, 2, 3, 4}));
+                                 }
+
+                                 stream.close();
+                             }};
+
+        auto total = 0uz;
+
+        while (auto chunk = stream.read())
+        {
+            total += chunk->size();
+        }
+
+        producer.join();
+
+        expect(total == 400);
+        expect(stream.finished());
+    };
+
+    "stream-cancel"_test = []
+    {
+        saucer::scheme::stream stream{4};
+
+        std::thread producer{[stream]() mutable
+                             {
+                                 while (stream.write(saucer::stash<>::from({1, 2, 3, 4})))
+                                 {
+                                 }
+                             }};
+
+        stream.cancel();
+        producer.join();
+
+        expect(stream.finished());
+        expect(!stream.poll().has_value());
+    };
+
+    "stream-ready"_test = []
+    {
+        saucer::scheme::stream stream{16};
+
+        auto total = 0uz;
+        auto count = 0;
+
+        stream.on_ready(
+            [&]
+            {
+                while (auto chunk = stream.poll())
+                {
+                    total += chunk->size();
+                }
+
+                if (stream.finished() || ++count < 4)
+                {
+                    return;
+                }
+
+                stream.write(saucer::stash<>::from({1, 2, 3, 4}));
+                stream.close();
+            });
+
+        for (auto i = 0; 3 > i; ++i)
+        {
+            stream.write(saucer::stash<>::from({1, 2, 3, 4}));
+        }
+
+        expect(total == 16);
+        expect(stream.finished());
+    };
+
+    "validators"_test = []
+    {
+        using namespace std::chrono;
+
+        const auto time = sys_days{1994y / November / 6} + 8h + 49min + 37s;
+        expect(saucer::scheme::http_date(time) == "Sun, 06 Nov 1994 08:49:37 GMT");
+
+        const auto first  = saucer::scheme::etag(saucer::stash<>::from({1, 2, 3}));
+        const auto second = saucer::scheme::etag(saucer::stash<>::from({1, 2, 4}));
+
+        expect(first.starts_with('"') && first.ends_with('"'));
+        expect(first != second);
+        expect(first == saucer::scheme::etag(saucer::stash<>::from({1, 2, 3})));
+    };
+};
@@ -0,0 +1,40 @@
+#include <boost/ut.hpp>
+#include <saucer/smartview.hpp>
+
+using namespace boost::ut;
+
+suite<"serializer"> serializer_suite = []
+{
+    using function_ptr = std::unique_ptr<saucer::function_data>;
+    using result_ptr   = std::unique_ptr<saucer::result_data>;
+
+    const saucer::default_serializer serializer{};
+
+    "parse-call"_test = [&]
+    {
+        auto parsed = serializer.parse(R"json({"saucer:call": true, "id": 1, "function": "sum", "params": [10, 5]})json");
+        expect(std::holds_alternative<function_ptr>(parsed));
+
+        const auto &data = std::get<function_ptr>(parsed);
+        expect(data->id == 1);
+        expect(data->function == saucer::function_id{"sum"});
+
+        parsed = serializer.parse(R"json({"saucer:call": true, "id": 2, "function": 3, "params": []})json");
+        expect(std::holds_alternative<function_ptr>(parsed));
+        expect(std::get<function_ptr>(parsed)->function == saucer::function_id{std::uint64_t{3}});
+    };
+
+    "parse-resolve"_test = [&]
+    {
+        auto parsed = serializer.parse(R"json({"saucer:resolve": true, "id": 2, "result": "saucer:call"})json");
+        expect(std::holds_alternative<result_ptr>(parsed));
+        expect(std::get<result_ptr>(parsed)->id == 2);
+    };
+
+    "parse-unrelated"_test = [&]
+    {
+        expect(std::holds_alternative<std::monostate>(serializer.parse(R"json({"saucer:startDrag": true})json")));
+        expect(std::holds_alternative<std::monostate>(serializer.parse(R"json({"id": 1, "saucer:call": true})json")));
+        expect(std::holds_alternative<std::monostate>(serializer.parse("dom_loaded")));
+    };
+};
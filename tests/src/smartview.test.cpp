@@ -1,6 +1,8 @@
 #include "test.hpp"
 #include "utils.hpp"
 
+#include <saucer/utils/future.hpp>
+
 using namespace boost::ut;
 using namespace saucer::tests;
 
@@ -25,6 +27,38 @@ suite<"smartview"> smartview_suite = []
         expect(smartview->evaluate<string_vec>("Array.of({})", saucer::make_args("1", "2")).get() == string_vec{"1", "2"});
     };
 
+    "evaluate-all"_test_async = [](const std::shared_ptr<saucer::smartview<>> &smartview)
+    {
+        smartview->set_url("https://saucer.github.io");
+
+        auto [a, b] = saucer::all(smartview->evaluate<int>("1 + 1"), smartview->evaluate<std::string>("'2'"));
+
+        expect(a == 2) << a;
+        expect(b == "2") << b;
+
+        std::future<int> future = smartview->evaluate<int>("3");
+        expect(future.get() == 3);
+    };
+
+    "evaluate-timeout"_test_async = [](const std::shared_ptr<saucer::smartview<>> &smartview)
+    {
+        using namespace std::chrono_literals;
+
+        smartview->set_url("https://saucer.github.io");
+
+        expect(smartview->evaluate<int>(5s, "10 + 5").get() == 15);
+
+        auto pending = smartview->evaluate<int>(100ms, "await new Promise(() => {{}})");
+        expect(throws<std::system_error>([&] { pending.get(); }));
+
+        std::promise<saucer::task<int>> nested;
+
+        smartview->evaluate<int>(100ms, "await new Promise(() => {{}})")
+            .then([&](auto) { nested.set_value(smartview->evaluate<int>(100ms, "await new Promise(() => {{}})")); });
+
+        expect(throws<std::system_error>([&] { nested.get_future().get().get(); }));
+    };
+
     "expose-basic"_test_async = [](const std::shared_ptr<saucer::smartview<>> &smartview)
     {
         smartview->expose("sum", [](int a, int b) { //
@@ -45,12 +79,57 @@ suite<"smartview"> smartview_suite = []
         smartview->set_url("https://saucer.github.io");
 
         expect(smartview->evaluate<int>("await saucer.exposed.sum(10, 5)").get() == 15);
+
+        const auto *batched = "(await Promise.all([saucer.exposed.sum(1, 2), saucer.exposed.sum(3, 4)])).at(1)";
+        expect(smartview->evaluate<int>(batched).get() == 7);
+
         expect(smartview->evaluate<int>("await saucer.exposed.sub(10, 5)").get() == 5);
 
         expect(smartview->evaluate<int>("await saucer.exposed.struct({{ x: 5 }})").get() == 5);
         expect(smartview->evaluate<int>("await saucer.exposed.struct({})", some_struct{5}).get() == 5);
     };
 
+    "expose-binary"_test_async = [](const std::shared_ptr<saucer::smartview<>> &smartview)
+    {
+        using bytes = std::vector<std::uint8_t>;
+
+        smartview->expose("reverse", [](std::span<const std::uint8_t> data) { //
+            return bytes{data.rbegin(), data.rend()};
+        });
+
+        smartview->set_url("https://saucer.github.io");
+
+        auto reversed = smartview->evaluate<bytes>("await saucer.exposed.reverse(new Uint8Array([1, 2, 3]))");
+        expect(reversed.get() == bytes{3, 2, 1});
+
+        expect(smartview->evaluate<bytes>("await saucer.exposed.reverse([4, 5])").get() == bytes{5, 4});
+        expect(smartview->evaluate<bytes>("{}", bytes{6, 7}).get() == bytes{6, 7});
+    };
+
+    "expose-async"_test_async = [](const std::shared_ptr<saucer::smartview<>> &smartview)
+    {
+        auto *view = smartview.get();
+
+        smartview->expose("later", [](int a) { //
+            return std::async(std::launch::async, [a] { return a * 2; });
+        });
+
+        smartview->expose("fail", []() -> saucer::task<int> { //
+            throw std::runtime_error{"failed"};
+            co_return 0;
+        });
+
+        smartview->expose("chained", [view](int a) -> saucer::task<int> { //
+            co_return co_await view->evaluate<int>("{} + 1", a);
+        });
+
+        smartview->set_url("https://saucer.github.io");
+
+        expect(smartview->evaluate<int>("await saucer.exposed.later(21)").get() == 42);
+        expect(smartview->evaluate<int>("await saucer.exposed.chained(4)").get() == 5);
+        expect(smartview->evaluate<std::string>("await saucer.exposed.fail().catch(e => e)").get() == "failed");
+    };
+
     "expose-executor"_test_async = [](const std::shared_ptr<saucer::smartview<>> &smartview)
     {
         smartview->expose("sum", [](int a, int b, const saucer::executor<int> &exec) { //
@@ -85,4 +164,18 @@ suite<"smartview"> smartview_suite = []
         expect(std::holds_alternative<std::string>(result.value()));
         expect(std::get<std::string>(result.value()) == "Not positive");
     };
+
+    "expose-clear"_test_async = [](const std::shared_ptr<saucer::smartview<>> &smartview)
+    {
+        smartview->expose("kept", [] { return 1; });
+        smartview->expose("gone", [] { return 2; });
+
+        smartview->set_url("https://saucer.github.io");
+
+        expect(smartview->evaluate<bool>("'gone' in saucer.internal.exposed").get());
+        smartview->clear_exposed("gone");
+
+        expect(not smartview->evaluate<bool>("'gone' in saucer.internal.exposed").get());
+        expect(smartview->evaluate<int>("await saucer.exposed.kept()").get() == 1);
+    };
 };
@@ -0,0 +1,29 @@
+#include <boost/ut.hpp>
+#include <saucer/webview.hpp>
+
+using namespace boost::ut;
+
+suite<"stash"> stash_suite = []
+{
+    "slice"_test = []
+    {
+        const auto stash = saucer::stash<>::from({1, 2, 3, 4, 5});
+        const auto slice = stash.slice(1, 3);
+
+        expect(slice.size() == 3);
+        expect(slice.data() == stash.data() + 1);
+        expect(slice.slice(2).size() == 1);
+
+        expect(stash.slice(10).size() == 0);
+        expect(stash.slice(3, 10).size() == 2);
+    };
+
+    "lazy"_test = []
+    {
+        const auto stash = saucer::stash<>::lazy([] { return saucer::stash<>::from({1, 2, 3}); });
+        const auto copy  = stash;
+
+        expect(copy.data() == stash.data());
+        expect(stash.slice(1).data() == stash.data() + 1);
+    };
+};
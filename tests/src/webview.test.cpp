@@ -140,6 +140,53 @@ suite<"webview"> webview_suite = []
         expect(not finished);
     };
 
+    "scheme-limits"_test_async = [](const auto &webview)
+    {
+        bool finished{false};
+        webview->expose("finish", [&finished] { finished = true; });
+
+        expect(not webview->handler_stats("test").has_value());
+
+        webview->handle_scheme(
+            "test",
+            [](const auto &)
+            {
+                const std::string html = R"html(
+                    <!DOCTYPE html>
+                    <html>
+                        <head>
+                            <script>
+                                saucer.exposed.finish();
+                            </script>
+                        </head>
+                    </html>
+                )html";
+
+                return saucer::scheme::response{
+                    .data = saucer::make_stash(html),
+                    .mime = "text/html",
+                };
+            },
+            {.concurrency = 1, .priority = saucer::scheme::priority::high});
+
+        webview->set_url("test://limits.html");
+
+        wait_for(finished);
+        expect(finished);
+
+        wait_for([&] { return webview->handler_stats("test")->completed > 0; });
+
+        const auto stats = webview->handler_stats("test");
+
+        expect(stats.has_value());
+        expect(stats->active == 0) << stats->active;
+        expect(stats->queued == 0) << stats->queued;
+        expect(stats->completed >= 1) << stats->completed;
+
+        webview->remove_scheme("test");
+        expect(not webview->handler_stats("test").has_value());
+    };
+
     "embed"_test_async = [](const auto &webview)
     {
         bool finished{false};
@@ -223,6 +270,57 @@ suite<"webview"> webview_suite = []
         expect(called == 1);
     };
 
+    "embed_shared"_test_async = [](const auto &webview)
+    {
+        std::vector<std::size_t> sizes;
+        bool finished{false};
+
+        webview->expose("finish",
+                        [&](std::vector<std::size_t> received)
+                        {
+                            sizes    = std::move(received);
+                            finished = true;
+                        });
+
+        const std::string page = R"html(
+            <!DOCTYPE html>
+            <html>
+                <head>
+                    <script>
+                        const requests = Array.from({ length: 8 }, () => fetch("shared.bin").then(r => r.arrayBuffer()));
+                        Promise.all(requests).then(buffers => saucer.exposed.finish(buffers.map(b => b.byteLength)));
+                    </script>
+                </head>
+            </html>
+        )html";
+
+        const auto owner = std::make_shared<std::vector<std::uint8_t>>(20uz * 1024 * 1024);
+        std::size_t called{};
+
+        webview->embed({
+            {"shared.html", saucer::embedded_file{.content = saucer::make_stash(page), .mime = "text/html"}},
+            {"shared.bin", saucer::embedded_file{
+                               .content = saucer::stash<>::lazy(
+                                   [owner, &called]
+                                   {
+                                       called++;
+                                       return saucer::stash<>::share(owner, *owner);
+                                   }),
+                               .mime = "application/octet-stream",
+                           }},
+        });
+
+        webview->serve("shared.html");
+
+        wait_for(finished);
+        expect(finished);
+
+        // Every request is answered from the very same (lazily produced) stash instead of a copy of its own.
+
+        expect(called == 1) << called;
+        expect(sizes == std::vector<std::size_t>(8, owner->size()));
+    };
+
     "execute"_test_async = [](const auto &webview)
     {
         webview->set_url("https://cppreference.com");
@@ -0,0 +1,35 @@
+#include <saucer/pack.hpp>
+
+#include <span>
+#include <cstdio>
+
+#include <fmt/core.h>
+
+int main(int argc, char **argv)
+{
+    const auto args = std::span{argv, static_cast<std::size_t>(argc)};
+
+    if (args.size() != 3)
+    {
+        fmt::print(stderr, "Usage: {} <directory> <output>\n", args[0]);
+        return 1;
+    }
+
+    if (!saucer::asset_pack::create(args[1], args[2]))
+    {
+        fmt::print(stderr, "Failed to pack '{}' into '{}'\n", args[1], args[2]);
+        return 1;
+    }
+
+    const auto pack = saucer::asset_pack::open(args[2]);
+
+    if (!pack.has_value())
+    {
+        fmt::print(stderr, "Failed to read back '{}'\n", args[2]);
+        return 1;
+    }
+
+    fmt::print("Packed {} file(s) into '{}'\n", pack->size(), args[2]);
+
+    return 0;
+}